@@ -0,0 +1,367 @@
+/*
+Problem Statement: Implement a Binary Search Tree that stays balanced under any sequence of insertions and deletions,
+supporting insert, erase, find, lower_bound and iteration over the keys in sorted (inorder) order.
+*/
+
+/*
+Algorithm / Intuition
+In a plain Binary Search Tree the shape depends on the order of insertion. Inserting keys in sorted order builds a chain, so every operation degrades to O(N).
+An AVL tree keeps the tree height-balanced at all times, in the exact sense checked by Check if the Binary tree is height-balanced or not:
+for every node the heights of the left and right subtrees differ by at most 1. Such a tree has a height of at most about 1.44 log2N, so every operation is O(log N).
+
+Every node caches the height of its subtree, computed as in the balance check: height = 1 + max(height(left), height(right)).
+An insertion or a deletion changes the heights only along the path from the root to the changed node, so after the recursive call returns to a node we update its height
+and look at its balance factor, height(left) - height(right). If it became +2 or -2 we repair the node with rotations:
+Left Left case (balance +2, left child leaning left or even): rotate right around the node.
+Left Right case (balance +2, left child leaning right): rotate left around the left child, then right around the node.
+Right Right and Right Left cases are the mirror images.
+A rotation changes only a constant number of links and keeps the inorder order of the keys, so it is O(1).
+
+The nodes are allocated from an arena: fixed size blocks of nodes handed out one after another, with erased nodes kept in a free list for reuse.
+This replaces one heap allocation per insertion with one per block and keeps nodes that were created together close in memory.
+
+The inorder iteration uses an explicit stack holding the path of nodes whose left subtree we are in, as in the Iterative Inorder Traversal.
+lower_bound builds the same stack while searching, so the iteration can continue from the key found.
+
+Algorithm:
+Step 1: insert(node, key): insert as in a Binary Search Tree recursively, ignoring duplicate keys, then update the height of the node and rebalance it.
+Step 2: erase(node, key): find the key recursively. A node with at most one child is replaced by that child. A node with two children takes the smallest key of its right subtree, which is then erased from the right subtree.
+Update the height and rebalance every node on the way back up.
+Step 3: find(key) / lowerBound(key): descend from the root comparing keys. lowerBound pushes every node where it moves left, as that node is a candidate for the answer.
+Step 4: Iteration: the top of the stack is the current key. To advance, pop it and push the leftmost path of its right subtree.
+*/
+
+
+#include <iostream>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <set>
+#include <random>
+#include <chrono>
+
+using namespace std;
+
+// Node structure for the AVL tree with
+// the cached height of its subtree
+struct Node {
+    int data;
+    int height;
+    Node* left;
+    Node* right;
+    // Constructor to initialize
+    // the node with a value
+    Node(int val) : data(val), height(1), left(nullptr), right(nullptr) {}
+};
+
+// Arena handing out nodes from fixed size
+// blocks, erased nodes are reused first
+class NodeArena {
+public:
+    Node* allocate(int val) {
+        Node* node;
+        if (freeList) {
+            // Reuse an erased node, the free
+            // list is linked through 'left'
+            node = freeList;
+            freeList = freeList->left;
+        }
+        else {
+            if (used == blockSize || blocks.empty()) {
+                blocks.emplace_back(static_cast<Node*>(::operator new(blockSize * sizeof(Node))));
+                used = 0;
+            }
+            node = blocks.back().get() + used++;
+        }
+        return new (node) Node(val);
+    }
+
+    void release(Node* node) {
+        node->left = freeList;
+        freeList = node;
+    }
+
+private:
+    // Deleter returning a raw block of nodes
+    struct BlockDeleter {
+        void operator()(Node* block) const { ::operator delete(block); }
+    };
+
+    static const int blockSize = 4096;
+    vector<unique_ptr<Node, BlockDeleter>> blocks;
+    int used = 0;
+    Node* freeList = nullptr;
+};
+
+class AVLTree {
+public:
+    // Iterator over the keys in inorder, holding
+    // the path of nodes whose left subtree
+    // contains the current position
+    class Iterator {
+    public:
+        int operator*() const { return st.back()->data; }
+        bool operator!=(const Iterator& other) const {
+            return (st.empty() ? nullptr : st.back()) != (other.st.empty() ? nullptr : other.st.back());
+        }
+        Iterator& operator++() {
+            Node* node = st.back()->right;
+            st.pop_back();
+            pushLeft(node);
+            return *this;
+        }
+
+    private:
+        friend class AVLTree;
+        void pushLeft(Node* node) {
+            while (node) {
+                st.push_back(node);
+                node = node->left;
+            }
+        }
+        vector<Node*> st;
+    };
+
+    // Function to insert a key, duplicate
+    // keys are ignored like in std::set
+    void insert(int key) {
+        root = insert(root, key);
+    }
+
+    // Function to erase a key if present
+    void erase(int key) {
+        root = erase(root, key);
+    }
+
+    // Function to check if a key is present
+    bool find(int key) const {
+        Node* node = root;
+        while (node) {
+            if (key == node->data) {
+                return true;
+            }
+            node = key < node->data ? node->left : node->right;
+        }
+        return false;
+    }
+
+    // Function to return an iterator to the
+    // first key not less than 'key'
+    Iterator lowerBound(int key) const {
+        Iterator it;
+        Node* node = root;
+        while (node) {
+            if (node->data >= key) {
+                // Candidate answer, the rest of the
+                // search continues in its left subtree
+                it.st.push_back(node);
+                node = node->left;
+            }
+            else {
+                node = node->right;
+            }
+        }
+        return it;
+    }
+
+    Iterator begin() const {
+        Iterator it;
+        it.pushLeft(root);
+        return it;
+    }
+
+    Iterator end() const {
+        return Iterator();
+    }
+
+    int size() const {
+        return count;
+    }
+
+    // Function to return the height
+    // of the tree, 0 when empty
+    int height() const {
+        return height(root);
+    }
+
+private:
+    Node* root = nullptr;
+    int count = 0;
+    NodeArena arena;
+
+    // Function to return the cached height,
+    // an empty subtree has height 0
+    static int height(Node* node) {
+        return node ? node->height : 0;
+    }
+
+    // Function to recompute the height of a
+    // node from the heights of its children
+    static void updateHeight(Node* node) {
+        node->height = max(height(node->left), height(node->right)) + 1;
+    }
+
+    // Function to rotate right around 'node'
+    // and return the new root of the subtree
+    static Node* rotateRight(Node* node) {
+        Node* pivot = node->left;
+        node->left = pivot->right;
+        pivot->right = node;
+        updateHeight(node);
+        updateHeight(pivot);
+        return pivot;
+    }
+
+    // Function to rotate left around 'node'
+    // and return the new root of the subtree
+    static Node* rotateLeft(Node* node) {
+        Node* pivot = node->right;
+        node->right = pivot->left;
+        pivot->left = node;
+        updateHeight(node);
+        updateHeight(pivot);
+        return pivot;
+    }
+
+    // Function to update the height of a node and
+    // repair it with rotations if it is unbalanced
+    static Node* rebalance(Node* node) {
+        updateHeight(node);
+        int balance = height(node->left) - height(node->right);
+
+        if (balance > 1) {
+            // Left Right case becomes Left Left
+            if (height(node->left->left) < height(node->left->right)) {
+                node->left = rotateLeft(node->left);
+            }
+            return rotateRight(node);
+        }
+        if (balance < -1) {
+            // Right Left case becomes Right Right
+            if (height(node->right->right) < height(node->right->left)) {
+                node->right = rotateRight(node->right);
+            }
+            return rotateLeft(node);
+        }
+        return node;
+    }
+
+    Node* insert(Node* node, int key) {
+        if (node == nullptr) {
+            count++;
+            return arena.allocate(key);
+        }
+        if (key < node->data) {
+            node->left = insert(node->left, key);
+        }
+        else if (key > node->data) {
+            node->right = insert(node->right, key);
+        }
+        else {
+            return node;
+        }
+        return rebalance(node);
+    }
+
+    Node* erase(Node* node, int key) {
+        if (node == nullptr) {
+            return nullptr;
+        }
+        if (key < node->data) {
+            node->left = erase(node->left, key);
+        }
+        else if (key > node->data) {
+            node->right = erase(node->right, key);
+        }
+        else if (node->left == nullptr || node->right == nullptr) {
+            // Replace the node by its only child
+            Node* child = node->left ? node->left : node->right;
+            arena.release(node);
+            count--;
+            return child;
+        }
+        else {
+            // Take the smallest key of the right subtree
+            // and erase that key from the right subtree
+            Node* succ = node->right;
+            while (succ->left) {
+                succ = succ->left;
+            }
+            node->data = succ->data;
+            node->right = erase(node->right, succ->data);
+        }
+        return rebalance(node);
+    }
+};
+
+// Function to time one call of 'fn'
+template <typename Fn>
+double timeMs(Fn fn) {
+    auto start = chrono::steady_clock::now();
+    fn();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+int main() {
+    AVLTree tree;
+
+    // Sorted insertions would build a chain
+    // in a plain Binary Search Tree
+    for (int i = 1; i <= 10; i++) {
+        tree.insert(i * 10);
+    }
+    tree.erase(40);
+
+    cout << "Keys: ";
+    for (AVLTree::Iterator it = tree.begin(); it != tree.end(); ++it) {
+        cout << *it << " ";
+    }
+    cout << endl;
+    cout << "Height: " << tree.height() << endl;
+    cout << "find(50): " << tree.find(50) << ", find(40): " << tree.find(40) << endl;
+    cout << "lower_bound(35): " << *tree.lowerBound(35) << endl;
+
+    // Benchmark against std::set on random
+    // and sorted keys, std::map uses the
+    // same red-black tree as std::set
+    int n = 1000000;
+    mt19937 rng(7);
+    vector<int> randomKeys(n), sortedKeys(n);
+    for (int i = 0; i < n; i++) {
+        randomKeys[i] = rng();
+        sortedKeys[i] = i;
+    }
+
+    for (int d = 0; d < 2; d++) {
+        vector<int>& keys = d == 0 ? randomKeys : sortedKeys;
+        AVLTree avl;
+        set<int> rb;
+        long long found = 0;
+
+        double avlMs = timeMs([&] {
+            for (int k : keys) avl.insert(k);
+            for (int k : keys) found += avl.find(k);
+            for (int i = 0; i < n; i += 2) avl.erase(keys[i]);
+        });
+        double setMs = timeMs([&] {
+            for (int k : keys) rb.insert(k);
+            for (int k : keys) found += rb.count(k);
+            for (int i = 0; i < n; i += 2) rb.erase(keys[i]);
+        });
+
+        cout << (d == 0 ? "Random" : "Sorted") << " keys, n = " << n
+             << ": AVL " << avlMs << " ms, std::set " << setMs << " ms" << endl;
+    }
+
+    return 0;
+}
+
+/*
+Time Complexity: O(log N) for insert, erase, find and lowerBound where N is the number of keys.
+The height of an AVL tree is at most about 1.44 log2N, every operation walks one root to leaf path and does O(1) work per node including the rotations.
+Iterating over all keys takes O(N) as every node is pushed onto and popped from the stack once.
+
+Space Complexity: O(N) for the nodes, each holding a key, a height and two child pointers, allocated in blocks of 4096 nodes.
+insert and erase recurse to a depth of O(log N) and an iterator holds a path of O(log N) nodes.
+*/
@@ -191,4 +191,239 @@ Since all these operations are performed sequentially, the overall time complexi
 Space Complexity: O(N) where N is the number of nodes in the Binary Tree to store the boundary nodes of the tree. O(H) or O(log2N) Recursive stack space while traversing the tree. 
 In the worst case scenario the tree is skewed and the auxiliary recursion stack space would be stacked up to the maximum depth of the tree, resulting in an O(N) auxiliary space complexity.
 */                           
-                        
\ No newline at end of file
+                        
+
+//Single Pass Approach :
+/*
+Algorithm / Intuition
+The solution above walks the left boundary, then the whole tree for the leaves, then the right boundary into a temporary vector that is copied back in reverse.
+All three parts can be collected in one iterative preorder traversal, where every node carries two flags telling whether it lies on the left or on the right boundary:
+The left child of the root is on the left boundary. The left child of a left boundary node is on it as well, and so is its right child when there is no left child.
+The right boundary is the mirror image: the right child of a right boundary node, or its left child when there is no right child.
+
+In preorder the left boundary is exactly the path taken before the first leaf, so its nodes are reached before any leaf and in the right order, and the leaves follow from left to right.
+Both are written to the front of the output. The right boundary has to come out bottom up, but preorder reaches it top down.
+As we know how many nodes it has after a short walk down the right side, we write the j-th right boundary node to the j-th slot from the end of the buffer,
+which puts them in bottom up order, and at the end move this block right behind the leaves. The result is written straight into the caller's buffer with no temporary vector.
+
+Only the leaves: a range whose iterator runs the same preorder with an explicit stack and stops at every leaf, so leaves are produced one at a time on demand.
+
+Algorithm:
+Step 1: If the root is a leaf, the boundary is the root alone. Otherwise write the root and walk down the right side from root->right to count the R non-leaf right boundary nodes.
+Step 2: Run a preorder traversal with a stack of (node, flags), starting with (root->left, left) and (root->right, right).
+Step 3: A leaf goes to the front. A non-leaf with the left flag goes to the front, with the right flag to slot capacity - 1 - j for the j-th such node. Pass the flags to the children as described above.
+Step 4: Move the R right boundary values right behind the front part and return the total count.
+*/
+
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <utility>
+
+using namespace std;
+
+// Node structure for the binary tree
+struct Node {
+    int data;
+    Node* left;
+    Node* right;
+    // Constructor to initialize
+    // the node with a value
+    Node(int val) : data(val), left(nullptr), right(nullptr) {}
+};
+
+// Function to check
+// if a node is a leaf
+bool isLeaf(Node* root) {
+    return !root->left && !root->right;
+}
+
+// Range over the leaves of a tree from left
+// to right, found one at a time on demand
+class LeafRange {
+public:
+    class Iterator {
+    public:
+        Node* operator*() const { return st.back(); }
+        // Iterators are equal when they are at the
+        // same leaf, or both past the last one
+        bool operator==(const Iterator& other) const {
+            return current() == other.current();
+        }
+        bool operator!=(const Iterator& other) const {
+            return current() != other.current();
+        }
+        Iterator& operator++() {
+            st.pop_back();
+            advance();
+            return *this;
+        }
+
+    private:
+        friend class LeafRange;
+        // Leaf the iterator is at, NULL at the end
+        Node* current() const {
+            return st.empty() ? NULL : st.back();
+        }
+        // Preorder until a leaf is on top of the stack
+        void advance() {
+            while (!st.empty() && !isLeaf(st.back())) {
+                Node* node = st.back();
+                st.pop_back();
+                if (node->right) {
+                    st.push_back(node->right);
+                }
+                if (node->left) {
+                    st.push_back(node->left);
+                }
+            }
+        }
+        vector<Node*> st;
+    };
+
+    LeafRange(Node* root) : root(root) {}
+
+    Iterator begin() const {
+        Iterator it;
+        if (root) {
+            it.st.push_back(root);
+            it.advance();
+        }
+        return it;
+    }
+
+    Iterator end() const {
+        return Iterator();
+    }
+
+private:
+    Node* root;
+};
+
+class Solution {
+public:
+    // Function to write the boundary traversal into 'out', which
+    // holds 'capacity' values (the number of nodes is always
+    // enough), returns the number written or -1 if it does not fit
+    int printBoundary(Node* root, int* out, int capacity) {
+        if (!root) {
+            return 0;
+        }
+        if (isLeaf(root)) {
+            if (capacity < 1) {
+                return -1;
+            }
+            out[0] = root->data;
+            return 1;
+        }
+
+        // Count the non-leaf nodes
+        // of the right boundary
+        int rightCount = 0;
+        for (Node* curr = root->right; curr && !isLeaf(curr);
+                curr = curr->right ? curr->right : curr->left) {
+            rightCount++;
+        }
+
+        int front = 0;
+        int back = 0;
+        int limit = capacity - rightCount;
+        if (limit < 1) {
+            return -1;
+        }
+        out[front++] = root->data;
+
+        st.clear();
+        if (root->right) {
+            st.push_back({root->right, onRight});
+        }
+        if (root->left) {
+            st.push_back({root->left, onLeft});
+        }
+
+        while (!st.empty()) {
+            Node* node = st.back().first;
+            int flags = st.back().second;
+            st.pop_back();
+
+            if (isLeaf(node) || (flags & onLeft)) {
+                if (front == limit) {
+                    return -1;
+                }
+                out[front++] = node->data;
+            }
+            else if (flags & onRight) {
+                // Top down into the tail from the
+                // end, which reads bottom up
+                out[capacity - 1 - back++] = node->data;
+            }
+
+            // Pass the boundary flags down
+            int leftFlags = (flags & onLeft) | (node->right ? 0 : flags & onRight);
+            int rightFlags = (flags & onRight) | (node->left ? 0 : flags & onLeft);
+            if (node->right) {
+                st.push_back({node->right, rightFlags});
+            }
+            if (node->left) {
+                st.push_back({node->left, leftFlags});
+            }
+        }
+
+        // Move the right boundary
+        // behind the leaves
+        copy(out + capacity - rightCount, out + capacity, out + front);
+        return front + rightCount;
+    }
+
+    // Function to return the
+    // leaves as a lazy range
+    LeafRange leaves(Node* root) {
+        return LeafRange(root);
+    }
+
+private:
+    // Boundary flags of a node
+    enum { onLeft = 1, onRight = 2 };
+
+    // Traversal stack reused across calls
+    vector<pair<Node*, int>> st;
+};
+
+int main() {
+    // Creating a sample binary tree
+    Node* root = new Node(1);
+    root->left = new Node(2);
+    root->right = new Node(3);
+    root->left->left = new Node(4);
+    root->left->right = new Node(5);
+    root->right->left = new Node(6);
+    root->right->right = new Node(7);
+
+    Solution solution;
+
+    // Pre-sized output, reused on every call
+    vector<int> out(7);
+    int count = solution.printBoundary(root, out.data(), out.size());
+
+    cout << "Boundary Traversal: ";
+    for (int i = 0; i < count; i++) {
+        cout << out[i] << " ";
+    }
+    cout << endl;
+
+    cout << "Leaves: ";
+    for (Node* leaf : solution.leaves(root)) {
+        cout << leaf->data << " ";
+    }
+    cout << endl;
+
+    return 0;
+}
+
+/*
+Time Complexity: O(N) where N is the number of nodes in the Binary Tree, as every node is visited once by the single traversal,
+plus O(H) for counting the right boundary and moving it. The leaves range visits every node once over a full iteration.
+
+Space Complexity: O(H) for the traversal stack where H is the height of the tree, reused across calls, and no temporary vector for the result, which is written into the caller's buffer.
+*/
@@ -162,4 +162,337 @@ In the worst case scenario the tree is skewed and the auxiliary recursion stack
 In the optimal case of a balanced tree, the auxiliary space would take up space proportional to O(log2N).
 */
                             
-                        
\ No newline at end of file
+                        
+
+//Iterative 64 Bit Approach :
+/*
+Algorithm / Intuition
+The recursive solution has two problems on large inputs. Its recursion depth is the height of the tree, so a deep or skewed tree overflows the call stack,
+and it adds the values of the children in int, which silently wraps around on large values and corrupts the result.
+
+The two phases per node are needed by the algorithm itself: values can only be increased, so a node first pushes its value down to a child if its children are too small,
+and only after both subtrees are fixed can it take the sum of its children. We keep both phases but run them with an explicit stack instead of recursion:
+every node is pushed twice, the first time it is popped we run the downward phase and push it back marked as visited followed by its children, the second time it is popped both subtrees are done
+and we run the upward phase. This visits the nodes in exactly the order of the recursive calls.
+
+The values are stored and added in 64 bits, and every addition is checked for overflow. In the default mode the transformation stops at the first sum that does not fit and returns false.
+The sum that overflowed is never written, so the nodes processed before keep their new values, all the other nodes keep their old ones, and no node holds a wrapped value.
+In the saturating mode a sum that does not fit is clamped to the largest (or smallest) 64 bit value, so the transformation always completes and only the saturated nodes miss the property.
+
+The read-only checker walks the tree in preorder with an explicit stack and returns the first node whose value differs from the sum of its children, computing the sum in 128 bits so that it is always exact.
+
+Parallel version: once the downward phase of a node has run, its two subtrees are independent until its upward phase, which only reads the two children.
+So as in the parallel tree construction we process the left subtree in a new task and the right subtree on the current thread, up to a depth with a few tasks per core, and use the iterative version below that.
+
+Algorithm:
+Step 1: Push (root, first visit). While the stack is not empty pop (node, visited).
+Step 2: First visit: child = left + right. If child >= node value set the node value to child, otherwise set the left child (or the right one) to the node value.
+Push (node, visited), then the right and the left child.
+Step 3: Second visit: if the node has a child set its value to left + right.
+Step 4: Every addition is checked: on overflow either stop without writing the sum and return false, or clamp the sum in the saturating mode.
+*/
+
+
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <climits>
+#include <atomic>
+#include <future>
+#include <thread>
+#include <algorithm>
+#include <chrono>
+
+using namespace std;
+
+// TreeNode structure with a 64 bit value
+struct TreeNode {
+    long long val;
+    TreeNode *left;
+    TreeNode *right;
+    TreeNode(long long x) : val(x), left(nullptr), right(nullptr) {}
+};
+
+
+class Solution {
+public:
+    // Function to change the values of the nodes based on
+    // the sum of its children's values without recursion,
+    // returns false and stops without writing the sum if
+    // a sum overflowed 64 bits
+    bool changeTree(TreeNode* root, bool saturate = false) {
+        saturating = saturate;
+        overflowed = false;
+        changeSubtree(root);
+        return !overflowed;
+    }
+
+    // Function to run changeTree on multiple threads
+    bool changeTreeParallel(TreeNode* root, bool saturate = false) {
+        saturating = saturate;
+        overflowed = false;
+
+        // Allow a few tasks per core
+        int cores = max(1u, thread::hardware_concurrency());
+        maxDepth = 2;
+        while ((1 << maxDepth) < 4 * cores) {
+            maxDepth++;
+        }
+
+        changeParallel(root, 0);
+        return !overflowed;
+    }
+
+    // Function to return the first node in preorder whose
+    // value differs from the sum of its children, or NULL
+    // if the tree has the Children Sum Property
+    TreeNode* firstViolation(TreeNode* root) {
+        vector<TreeNode*> st;
+        if (root) {
+            st.push_back(root);
+        }
+        while (!st.empty()) {
+            TreeNode* node = st.back();
+            st.pop_back();
+            if (node->left || node->right) {
+                // 128 bit sum, always exact
+                __int128 sum = 0;
+                if (node->left) {
+                    sum += node->left->val;
+                }
+                if (node->right) {
+                    sum += node->right->val;
+                }
+                if (sum != node->val) {
+                    return node;
+                }
+            }
+            if (node->right) {
+                st.push_back(node->right);
+            }
+            if (node->left) {
+                st.push_back(node->left);
+            }
+        }
+        return NULL;
+    }
+
+private:
+    bool saturating = false;
+    atomic<bool> overflowed{false};
+    int maxDepth = 0;
+
+    // Function to add two values into 'sum', clamping the result
+    // in the saturating mode, returns false on overflow otherwise
+    bool add(long long a, long long b, long long& sum) {
+        if (__builtin_add_overflow(a, b, &sum)) {
+            if (saturating) {
+                sum = a > 0 ? LLONG_MAX : LLONG_MIN;
+                return true;
+            }
+            overflowed = true;
+            return false;
+        }
+        return true;
+    }
+
+    // Function to compute the sum of the values of the
+    // children of 'node', returns false on overflow
+    bool childSum(TreeNode* node, long long& child) {
+        child = 0;
+        if (node->left) {
+            child = node->left->val;
+        }
+        if (node->right) {
+            if (node->left) {
+                return add(child, node->right->val, child);
+            }
+            child = node->right->val;
+        }
+        return true;
+    }
+
+    // Downward phase: raise the node to the sum of its
+    // children, or push its value down to a child
+    void pushDown(TreeNode* node) {
+        long long child;
+        if (!childSum(node, child)) {
+            return;
+        }
+        if (child >= node->val) {
+            node->val = child;
+        } else if (node->left) {
+            node->left->val = node->val;
+        } else if (node->right) {
+            node->right->val = node->val;
+        }
+    }
+
+    // Upward phase: take the sum of the
+    // children once both subtrees are done
+    void pullUp(TreeNode* node) {
+        long long child;
+        if ((node->left || node->right) && childSum(node, child)) {
+            node->val = child;
+        }
+    }
+
+    // Function to run both phases on every node of
+    // the subtree, in the order of the recursion
+    void changeSubtree(TreeNode* root) {
+        vector<pair<TreeNode*, bool>> st;
+        if (root) {
+            st.push_back({root, false});
+        }
+        // Stop at the first overflow
+        while (!st.empty() && !overflowed) {
+            TreeNode* node = st.back().first;
+            bool visited = st.back().second;
+            st.pop_back();
+
+            if (visited) {
+                pullUp(node);
+                continue;
+            }
+            pushDown(node);
+            st.push_back({node, true});
+            if (node->right) {
+                st.push_back({node->right, false});
+            }
+            if (node->left) {
+                st.push_back({node->left, false});
+            }
+        }
+    }
+
+    // Function to process the left subtree in a new task
+    // and the right one on the current thread while the
+    // depth allows it
+    void changeParallel(TreeNode* node, int depth) {
+        if (node == NULL || overflowed) {
+            return;
+        }
+        if (depth >= maxDepth) {
+            changeSubtree(node);
+            return;
+        }
+        pushDown(node);
+        future<void> left = async(launch::async, [=] {
+            changeParallel(node->left, depth + 1);
+        });
+        changeParallel(node->right, depth + 1);
+        left.get();
+        // Either subtree may have
+        // stopped at an overflow
+        if (!overflowed) {
+            pullUp(node);
+        }
+    }
+};
+
+
+// Function to print the inorder
+// traversal of the tree
+void inorderTraversal(TreeNode* root) {
+    if (root == nullptr) {
+        return;
+    }
+    inorderTraversal(root->left);
+    cout << root->val << " ";
+    inorderTraversal(root->right);
+}
+
+// Function to build a tree with 'n' nodes
+// and pseudo random values and shape
+TreeNode* buildTree(int n, unsigned seed) {
+    vector<TreeNode*> nodes;
+    for (int i = 0; i < n; i++) {
+        seed = seed * 1103515245u + 12345u;
+        nodes.push_back(new TreeNode((seed >> 8) % 1000));
+        if (i > 0) {
+            // Attach to a random earlier node
+            // with a free child slot
+            TreeNode* par = nodes[(seed >> 4) % i];
+            while (par->left && par->right) {
+                par = par->left;
+            }
+            (par->left ? par->right : par->left) = nodes[i];
+        }
+    }
+    return n ? nodes[0] : NULL;
+}
+
+int main() {
+    // Create the binary tree
+    TreeNode* root = new TreeNode(3);
+    root->left = new TreeNode(5);
+    root->right = new TreeNode(1);
+    root->left->left = new TreeNode(6);
+    root->left->right = new TreeNode(2);
+    root->right->left = new TreeNode(0);
+    root->right->right = new TreeNode(8);
+    root->left->right->left = new TreeNode(7);
+    root->left->right->right = new TreeNode(4);
+
+    Solution sol;
+
+    cout << "Binary Tree before modification: ";
+    inorderTraversal(root);
+    cout << endl;
+    cout << "First violating node: " << sol.firstViolation(root)->val << endl;
+
+    sol.changeTree(root);
+
+    cout << "Binary Tree after Children Sum Property: " ;
+    inorderTraversal(root);
+    cout << endl;
+    cout << "Property holds: " << (sol.firstViolation(root) == NULL) << endl;
+
+    // Values that overflow int, and
+    // then even 64 bits
+    TreeNode* big = new TreeNode(0);
+    big->left = new TreeNode(3000000000LL);
+    big->right = new TreeNode(4000000000LL);
+    cout << "64 bit sum: " << sol.changeTree(big) << ", root = " << big->val << endl;
+
+    big->left->val = LLONG_MAX;
+    cout << "Overflow without saturation: " << !sol.changeTree(big)
+         << ", root left at " << big->val << endl;
+    big->left->val = LLONG_MAX;
+    sol.changeTree(big, true);
+    cout << "Saturated root: " << big->val << endl;
+
+    // A chain of a million nodes would overflow
+    // the call stack of the recursive version
+    TreeNode* chain = new TreeNode(1);
+    TreeNode* curr = chain;
+    for (int i = 0; i < 1000000; i++) {
+        curr->left = new TreeNode(0);
+        curr = curr->left;
+    }
+    sol.changeTree(chain);
+    cout << "Deep chain fixed: " << (sol.firstViolation(chain) == NULL) << endl;
+
+    // Sequential and parallel on the same tree
+    int n = 1 << 21;
+    TreeNode* t1 = buildTree(n, 7);
+    TreeNode* t2 = buildTree(n, 7);
+    auto start = chrono::steady_clock::now();
+    sol.changeTree(t1);
+    auto mid = chrono::steady_clock::now();
+    sol.changeTreeParallel(t2);
+    auto end = chrono::steady_clock::now();
+    cout << "n = " << n << ": sequential "
+         << chrono::duration<double, milli>(mid - start).count() << " ms, parallel "
+         << chrono::duration<double, milli>(end - mid).count() << " ms, same root: "
+         << (t1->val == t2->val) << endl;
+
+    return 0;
+}
+
+/*
+Time Complexity: O(N) where N is the number of nodes in the binary tree, as every node is pushed twice and does a constant amount of work per visit.
+The checker is O(N) as well, and stops at the first violating node. The parallel version divides the same work over the cores when the tree is reasonably balanced.
+
+Space Complexity: O(N) in the worst case for the explicit stack, which lives on the heap so that a skewed tree cannot overflow the call stack, and O(H) for a balanced tree where H is its height.
+*/
@@ -235,4 +235,225 @@ Space Complexity : O(1) as no additional space or data structures is created tha
 O(H) Recursive Stack Auxiliary Space : The recursion stack space is determined by the maximum depth of the recursion, which is the height of the binary tree denoted as H. 
 In the balanced case it is log2N and in the worst case its N.
 */                             
-                            
\ No newline at end of file
+                            
+
+//Incremental Approach :
+/*
+Algorithm / Intuition
+The optimal approach computes every height again on every call, which costs O(N) per check even if only one node changed since the last check.
+When small updates alternate with balance checks, we can keep the answer up to date instead of recomputing it.
+Every node caches the height of its subtree and a flag telling whether its subtree is balanced:
+height(node) = 1 + max(height(left), height(right)) and balanced(node) = balanced(left) && balanced(right) && |height(left) - height(right)| <= 1.
+Both values of a node depend only on its children, so inserting or deleting a node can only change the cached values of the ancestors of that position.
+After a change we recompute the cached values walking up the parent pointers to the root.
+If a node ends up with the same height and flag as before, nothing above it can change either, so the walk stops early.
+The tree is then balanced exactly when the flag of the root is set, which is an O(1) check. The recursive dfsHeight from above is kept to verify the cached values.
+
+Algorithm:
+Step 1: Store data, height, balanced, left, right and parent in every node. A new leaf has height 1 and is balanced.
+Step 2: insert(parent, value, asLeft): link a new leaf into an empty child slot of 'parent', then update the path from 'parent' to the root.
+If the requested slot already holds a child, return NULL and leave the tree unchanged, so no subtree is lost and the cached values stay valid.
+Step 3: erase(node): if the node has two children, hang its left subtree under the leftmost node of its right subtree and update the path from there.
+Then splice the node out by linking its only child (or NULL) to its parent, and update the path from the parent.
+Step 4: update(node): while the node is not NULL recompute its height and flag from its children, stop if neither changed, otherwise move to the parent.
+Step 5: isBalanced(): return the flag of the root, an empty tree is balanced.
+*/
+
+
+#include <iostream>
+#include <algorithm>
+#include <cstdlib>
+
+using namespace std;
+
+// Node structure for the binary tree with the
+// cached height and balance flag of its subtree
+struct Node {
+    int data;
+    int height;
+    bool balanced;
+    Node* left;
+    Node* right;
+    Node* parent;
+    // Constructor to initialize
+    // the node with a value
+    Node(int val) : data(val), height(1), balanced(true),
+        left(nullptr), right(nullptr), parent(nullptr) {}
+};
+
+class BalancedTracker {
+public:
+    Node* root = nullptr;
+
+    // Function to check if the tree is balanced
+    // using the cached flag of the root
+    bool isBalanced() {
+        return root == nullptr || root->balanced;
+    }
+
+    // Function to return the height of the
+    // tree using the cached height of the root
+    int maxDepth() {
+        return height(root);
+    }
+
+    // Function to add a new leaf as the left or right child
+    // of 'parent', or as the root if 'parent' is NULL,
+    // returns NULL if that child slot is already taken
+    Node* insert(Node* parent, int val, bool asLeft) {
+        if (parent && (asLeft ? parent->left : parent->right)) {
+            return nullptr;
+        }
+        Node* node = new Node(val);
+        if (parent == nullptr) {
+            node->left = root;
+            if (root) {
+                root->parent = node;
+            }
+            root = node;
+            update(node);
+            return node;
+        }
+        if (asLeft) {
+            parent->left = node;
+        }
+        else {
+            parent->right = node;
+        }
+        node->parent = parent;
+        update(parent);
+        return node;
+    }
+
+    // Function to remove a node, keeping the
+    // inorder order of the remaining nodes
+    void erase(Node* node) {
+        if (node->left && node->right) {
+            // Hang the left subtree under the leftmost
+            // node of the right subtree so the node
+            // is left with a single child
+            Node* succ = node->right;
+            while (succ->left) {
+                succ = succ->left;
+            }
+            succ->left = node->left;
+            succ->left->parent = succ;
+            node->left = nullptr;
+            update(succ);
+        }
+
+        // Splice out the node with at most one child
+        Node* child = node->left ? node->left : node->right;
+        Node* parent = node->parent;
+        if (child) {
+            child->parent = parent;
+        }
+        if (parent == nullptr) {
+            root = child;
+        }
+        else if (parent->left == node) {
+            parent->left = child;
+        }
+        else {
+            parent->right = child;
+        }
+        delete node;
+        update(parent);
+    }
+
+    // Recursive function from above to calculate the
+    // height of the tree, or -1 if it is unbalanced,
+    // used to verify the cached values
+    int dfsHeight(Node* root) {
+        if (root == NULL) return 0;
+
+        int leftHeight = dfsHeight(root->left);
+        if (leftHeight == -1)
+            return -1;
+
+        int rightHeight = dfsHeight(root->right);
+        if (rightHeight == -1)
+            return -1;
+
+        if (abs(leftHeight - rightHeight) > 1)
+            return -1;
+
+        return max(leftHeight, rightHeight) + 1;
+    }
+
+private:
+    // Function to return the cached height,
+    // an empty subtree has height 0
+    static int height(Node* node) {
+        return node ? node->height : 0;
+    }
+
+    // Function to recompute the cached values
+    // on the path from 'node' to the root,
+    // stopping once a node does not change
+    void update(Node* node) {
+        while (node) {
+            int lh = height(node->left);
+            int rh = height(node->right);
+            int newHeight = max(lh, rh) + 1;
+            bool newBalanced = abs(lh - rh) <= 1 &&
+                (node->left == nullptr || node->left->balanced) &&
+                (node->right == nullptr || node->right->balanced);
+
+            // Nothing above can change if
+            // this node did not change
+            if (newHeight == node->height && newBalanced == node->balanced) {
+                return;
+            }
+            node->height = newHeight;
+            node->balanced = newBalanced;
+            node = node->parent;
+        }
+    }
+};
+
+// Main function
+int main() {
+    BalancedTracker tree;
+
+    // Creating a sample binary tree
+    Node* root = tree.insert(nullptr, 1, true);
+    Node* two = tree.insert(root, 2, true);
+    tree.insert(root, 3, false);
+    tree.insert(two, 4, true);
+    Node* five = tree.insert(two, 5, false);
+
+    cout << "Height " << tree.maxDepth() << ", "
+         << (tree.isBalanced() ? "balanced" : "not balanced") << endl;
+
+    // Growing the tree below 5
+    // unbalances the root
+    Node* six = tree.insert(five, 6, false);
+    cout << "After inserting 6: height " << tree.maxDepth() << ", "
+         << (tree.isBalanced() ? "balanced" : "not balanced") << endl;
+
+    // An occupied slot is rejected
+    // and the tree is unchanged
+    cout << "Inserting into the taken right slot of 5: "
+         << (tree.insert(five, 7, false) == nullptr ? "rejected" : "inserted") << endl;
+
+    // Removing it restores the balance
+    tree.erase(six);
+    cout << "After erasing 6: height " << tree.maxDepth() << ", "
+         << (tree.isBalanced() ? "balanced" : "not balanced") << endl;
+
+    // Verifying the cached answer with
+    // the O(N) recursive computation
+    cout << "Verified by dfsHeight: "
+         << ((tree.dfsHeight(tree.root) != -1) == tree.isBalanced() ? "yes" : "no") << endl;
+
+    return 0;
+}
+
+/*
+Time Complexity: O(1) for isBalanced and maxDepth as they read the cached values of the root.
+O(H) for insert and erase where H is the height of the Binary Tree, as only the ancestors of the changed position are updated and the walk often stops early.
+The O(N) dfsHeight is only needed to verify the cached values.
+
+Space Complexity: O(N) for the height, flag and parent pointer stored in every node. The updates run in a loop and use O(1) extra space.
+*/
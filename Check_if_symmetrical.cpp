@@ -139,4 +139,194 @@ O(H): Recursive Stack Space is used to calculate the height of the tree at each
 The recursive nature of the getHeight function, which incurs space on the call stack for each recursive call until it reaches the leaf nodes or the height of the tree.
 */
                             
-                        
\ No newline at end of file
+                        
+
+//Memoized Mirrored Hash Approach :
+/*
+Algorithm / Intuition
+isSymmetric walks both halves of a subtree, so asking it about many subtrees of the same tree repeats the same comparisons, O(N^2) in total.
+Instead we give every subtree a forward id and a mirrored id in one bottom-up pass, and answer every query from them.
+
+Two subtrees get the same forward id exactly when they are identical. The id of a node is looked up from the key (data, id(left), id(right)),
+with 0 for an empty subtree: if the key was seen before the node gets the same id, otherwise a new one. As the child ids already identify the children exactly,
+equal keys mean identical subtrees, so unlike a plain hash these ids never collide.
+The mirrored id of a node is the forward id its mirror image would have. The mirror of a node has the same value, the mirror of its right subtree on the left and the mirror of its left subtree on the right,
+so it is looked up from the key (data, mirrored(right), mirrored(left)) in the same table.
+
+A subtree is symmetric when its left subtree is the mirror image of its right subtree, that is forward(left) == mirrored(right).
+Every node is checked once during the pass, so afterwards "is this subtree symmetric" is an O(1) lookup and all symmetric subtrees are enumerated in O(N).
+
+Algorithm:
+Step 1: Traverse the tree in postorder with an explicit stack, so both children are done before the node and deep trees do not overflow the call stack.
+Step 2: For every node look up forward = id(data, forward(left), forward(right)) and mirrored = id(data, mirrored(right), mirrored(left)), creating new ids for new keys.
+Step 3: Mark the node symmetric if forward(left) == mirrored(right) and append it to the list of symmetric subtrees.
+Step 4: isSymmetric(node) returns the stored mark, symmetricSubtrees() returns the list.
+*/
+
+
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <utility>
+
+using namespace std;
+
+// Node structure for the binary tree
+struct Node {
+    int data;
+    Node* left;
+    Node* right;
+    // Constructor to initialize
+    // the node with a value
+    Node(int val) : data(val), left(nullptr), right(nullptr) {}
+};
+
+class SymmetryIndex {
+public:
+    // Function to compute the forward and mirrored
+    // ids of every subtree of 'root' in one pass
+    void build(Node* root) {
+        info.clear();
+        ids.clear();
+        symmetric.clear();
+        if (root == NULL) {
+            return;
+        }
+
+        // Iterative postorder: a node is processed
+        // once both its children are done
+        vector<pair<Node*, bool>> st;
+        st.push_back({root, false});
+        while (!st.empty()) {
+            Node* node = st.back().first;
+            bool childrenDone = st.back().second;
+            st.pop_back();
+
+            if (!childrenDone) {
+                st.push_back({node, true});
+                if (node->right) {
+                    st.push_back({node->right, false});
+                }
+                if (node->left) {
+                    st.push_back({node->left, false});
+                }
+                continue;
+            }
+
+            SubtreeInfo l = infoOf(node->left);
+            SubtreeInfo r = infoOf(node->right);
+
+            SubtreeInfo cur;
+            cur.forward = idOf(node->data, l.forward, r.forward);
+            // The mirror has the mirrored right
+            // subtree on the left and vice versa
+            cur.mirrored = idOf(node->data, r.mirrored, l.mirrored);
+            cur.symmetric = (l.forward == r.mirrored);
+
+            if (cur.symmetric) {
+                symmetric.push_back(node);
+            }
+            info[node] = cur;
+        }
+    }
+
+    // Function to check if the subtree rooted
+    // at 'node' is symmetric, in O(1)
+    bool isSymmetric(Node* node) const {
+        if (node == NULL) {
+            return true;
+        }
+        return info.at(node).symmetric;
+    }
+
+    // Function to check if two subtrees of the
+    // indexed tree are identical, in O(1)
+    bool isIdentical(Node* node1, Node* node2) const {
+        return infoOf(node1).forward == infoOf(node2).forward;
+    }
+
+    // Function to return the roots of all symmetric
+    // subtrees, in postorder of the tree
+    const vector<Node*>& symmetricSubtrees() const {
+        return symmetric;
+    }
+
+private:
+    struct SubtreeInfo {
+        int forward = 0;
+        int mirrored = 0;
+        bool symmetric = true;
+    };
+
+    struct KeyHash {
+        size_t operator()(const pair<int, uint64_t>& k) const {
+            uint64_t h = k.second * 0x9e3779b97f4a7c15ull;
+            return h ^ ((uint64_t)(uint32_t)k.first + 0x7f4a7c15ull + (h << 6) + (h >> 2));
+        }
+    };
+
+    // Forward and mirrored ids of every node
+    unordered_map<Node*, SubtreeInfo> info;
+    // Id of every distinct (data, left id, right id)
+    unordered_map<pair<int, uint64_t>, int, KeyHash> ids;
+    vector<Node*> symmetric;
+
+    // Ids of an empty subtree are 0
+    SubtreeInfo infoOf(Node* node) const {
+        if (node == NULL) {
+            return SubtreeInfo();
+        }
+        return info.at(node);
+    }
+
+    // Function to return the id of the subtree with
+    // root value 'data' and children ids 'l' and 'r'
+    int idOf(int data, int l, int r) {
+        pair<int, uint64_t> key(data, ((uint64_t)(uint32_t)l << 32) | (uint32_t)r);
+        auto it = ids.find(key);
+        if (it != ids.end()) {
+            return it->second;
+        }
+        int id = ids.size() + 1;
+        ids.emplace(key, id);
+        return id;
+    }
+};
+
+
+int main() {
+    // Creating a sample binary tree whose
+    // root is not symmetric but some of
+    // its subtrees are
+    Node* root = new Node(1);
+    root->left = new Node(2);
+    root->right = new Node(5);
+    root->left->left = new Node(3);
+    root->left->right = new Node(3);
+    root->left->left->left = new Node(4);
+    root->left->right->right = new Node(4);
+    root->right->left = new Node(6);
+
+    SymmetryIndex index;
+    index.build(root);
+
+    cout << "Whole tree symmetric: " << index.isSymmetric(root) << endl;
+    cout << "Left subtree symmetric: " << index.isSymmetric(root->left) << endl;
+    cout << "Right subtree symmetric: " << index.isSymmetric(root->right) << endl;
+
+    cout << "Roots of the symmetric subtrees: ";
+    for (Node* node : index.symmetricSubtrees()) {
+        cout << node->data << " ";
+    }
+    cout << endl;
+
+    return 0;
+}
+
+/*
+Time Complexity: O(N) expected for build where N is the number of nodes, as every node is visited once and does a constant number of hash table operations.
+Every isSymmetric query after that is O(1), and enumerating the symmetric subtrees is O(N).
+
+Space Complexity: O(N) for the ids of every node, the table of distinct subtrees and the stack of the postorder traversal.
+*/
@@ -165,4 +165,795 @@ The inorder hashmap to store the inorder array for fast lookup takes up space pr
 An auxiliary stack space ~ O(H) where H is the height of the Binary Tree is used. This is the stack space used to build the tree recursively. 
 In the case of a skewed tree, the height of the tree will be H ~ N hence the worst case auxiliary space is O(N).
 */                            
-                        
\ No newline at end of file
+                        
+
+//Iterative Stack Based Approach :
+/*
+Algorithm / Intuition
+The recursive solution needs a map from value to inorder index, which costs O(N log N) time and one allocation per entry,
+and its recursion depth equals the height of the tree, so a skewed tree of a few million nodes overflows the call stack.
+We can build the tree without looking up any index by walking the preorder array and the inorder array together.
+
+In preorder, every node is followed by its left child if it has one. In inorder, the leftmost node of a subtree comes first.
+So while the node we last created is not the next node in inorder, the next preorder value must be its left child.
+Once the top of the stack matches the next inorder value, the left subtree of that node is complete. We pop nodes from the stack while they match inorder,
+because each matching node has finished its left subtree and itself. The next preorder value is then the right child of the last node we popped.
+The stack always holds the path of nodes whose right child has not been decided yet, which is exactly what the recursion kept on the call stack.
+
+All nodes are allocated from one contiguous buffer reserved up front, which avoids one heap allocation per node and keeps the nodes next to each other in memory.
+The buffer is returned together with the root in a Tree that owns the nodes, so every tree built stays valid on its own, however many trees the same Solution builds afterwards.
+
+Algorithm:
+Step 1: If the arrays are empty or their sizes differ return an empty tree. Reserve a buffer of N nodes and create the root from preorder[0]. Push it onto the stack and set the inorder index to 0.
+Step 2: For every following preorder value:
+If the top of the stack does not match inorder[index], create the value as the left child of the top and push it.
+Otherwise, pop nodes while the top of the stack matches inorder[index], advancing index after every pop. Create the value as the right child of the last popped node and push it.
+Step 3: Return the tree holding the buffer and the root.
+*/
+
+
+#include <iostream>
+#include <vector>
+#include <map>
+#include <chrono>
+#include <numeric>
+#include <algorithm>
+#include <random>
+
+using namespace std;
+
+// TreeNode structure
+struct TreeNode {
+    int val;
+    TreeNode *left;
+    TreeNode *right;
+    TreeNode(int x) : val(x), left(nullptr), right(nullptr) {}
+};
+
+// Tree whose nodes live in one contiguous buffer
+// owned by the tree. It can be moved but not
+// copied, as the nodes point into the buffer
+struct Tree {
+    vector<TreeNode> nodes;
+    TreeNode* root = NULL;
+
+    Tree() = default;
+    Tree(Tree&&) = default;
+    Tree& operator=(Tree&&) = default;
+    Tree(const Tree&) = delete;
+    Tree& operator=(const Tree&) = delete;
+};
+
+class Solution {
+public:
+    // Function to build a binary tree from preorder
+    // and inorder traversals without recursion
+    Tree buildTree(vector<int>& preorder, vector<int>& inorder){
+        Tree tree;
+        int n = preorder.size();
+        if(n == 0 || n != (int)inorder.size()){
+            return tree;
+        }
+
+        // Reserve the whole buffer so the node
+        // addresses stay valid while we build
+        vector<TreeNode>& pool = tree.nodes;
+        pool.reserve(n);
+
+        // Stack of nodes whose right
+        // child is not decided yet
+        vector<TreeNode*> st;
+        pool.emplace_back(preorder[0]);
+        tree.root = &pool.back();
+        st.push_back(tree.root);
+
+        int in = 0;
+        for(int i = 1; i < n; i++){
+            TreeNode* node = st.back();
+            pool.emplace_back(preorder[i]);
+            TreeNode* child = &pool.back();
+
+            if(node->val != inorder[in]){
+                // The left subtree of the top
+                // is not finished yet
+                node->left = child;
+            }
+            else{
+                // Pop every node whose left subtree
+                // and itself are finished in inorder
+                while(!st.empty() && st.back()->val == inorder[in]){
+                    node = st.back();
+                    st.pop_back();
+                    in++;
+                }
+                // The next preorder value is the
+                // right child of the last popped node
+                node->right = child;
+            }
+            st.push_back(child);
+        }
+        return tree;
+    }
+};
+
+// Recursive map based builder from
+// above, used as the benchmark baseline
+class RecursiveSolution {
+public:
+    TreeNode* buildTree(vector<int>& preorder, vector<int>& inorder){
+        map<int, int> inMap;
+        for(int i = 0; i < (int)inorder.size(); i++){
+            inMap[inorder[i]] = i;
+        }
+        return buildTree(preorder, 0, preorder.size()-1, inorder, 0, inorder.size()-1, inMap);
+    }
+
+private:
+    TreeNode* buildTree(vector<int>& preorder, int preStart, int preEnd,
+            vector<int>& inorder, int inStart, int inEnd, map<int, int>& inMap){
+        if(preStart > preEnd || inStart > inEnd){
+            return NULL;
+        }
+        TreeNode* root = new TreeNode(preorder[preStart]);
+        int inRoot = inMap[root->val];
+        int numsLeft = inRoot - inStart;
+        root->left = buildTree(preorder, preStart + 1, preStart + numsLeft,
+                        inorder, inStart, inRoot - 1, inMap);
+        root->right = buildTree(preorder, preStart + numsLeft + 1, preEnd,
+                        inorder, inRoot + 1, inEnd, inMap);
+        return root;
+    }
+};
+
+// Function to print the
+// inorder traversal of a tree
+void printInorder(TreeNode* root){
+    if(!root){
+        return;
+    }
+    printInorder(root->left);
+    cout << root->val << " ";
+    printInorder(root->right);
+}
+
+// Function to print the
+// given vector
+void printVector(vector<int>&vec){
+    for(int i = 0; i < (int)vec.size(); i++){
+        cout << vec[i] << " ";
+    }
+    cout << endl;
+}
+
+// Function to generate the preorder and
+// inorder traversals of a random tree with
+// distinct values 0 ... n-1, or of a left
+// skewed chain when 'chain' is true
+void makeTraversals(int n, bool chain, vector<int>& preorder, vector<int>& inorder){
+    // Shuffled values are the inorder sequence,
+    // picking a root inside every range gives
+    // the preorder sequence
+    inorder.resize(n);
+    iota(inorder.begin(), inorder.end(), 0);
+    mt19937 rng(42);
+    shuffle(inorder.begin(), inorder.end(), rng);
+
+    preorder.clear();
+    preorder.reserve(n);
+    vector<pair<int, int>> ranges = {{0, n - 1}};
+    while(!ranges.empty()){
+        int lo = ranges.back().first, hi = ranges.back().second;
+        ranges.pop_back();
+        if(lo > hi){
+            continue;
+        }
+        int mid = chain ? hi : lo + (int)(rng() % (hi - lo + 1));
+        preorder.push_back(inorder[mid]);
+        ranges.push_back({mid + 1, hi});
+        ranges.push_back({lo, mid - 1});
+    }
+}
+
+// Function to time one call of 'build'
+template <typename Fn>
+double timeMs(Fn build){
+    auto start = chrono::steady_clock::now();
+    build();
+    auto end = chrono::steady_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
+int main() {
+    vector<int> inorder = {9, 3, 15, 20, 7};
+    vector<int> preorder = {3, 9, 20, 15, 7};
+
+    cout << "Inorder Vector: ";
+    printVector(inorder);
+
+    cout << "Preorder Vector: ";
+    printVector(preorder);
+
+    Solution sol;
+
+    Tree tree = sol.buildTree(preorder, inorder);
+
+    cout << "Inorder of Unique Binary Tree Created: "<< endl;
+    printInorder(tree.root);
+    cout << endl;
+
+    // Benchmark: raise n to 50000000 for the
+    // full sized inputs, the recursive builder
+    // is skipped on the chain as it overflows
+    // the call stack on long chains
+    int n = 1000000;
+    for(bool chain : {false, true}){
+        makeTraversals(n, chain, preorder, inorder);
+        double stackMs = timeMs([&]{ sol.buildTree(preorder, inorder); });
+        cout << (chain ? "Chain" : "Random") << " tree, n = " << n
+             << ": stack based " << stackMs << " ms";
+        if(!chain){
+            RecursiveSolution rec;
+            double recMs = timeMs([&]{ rec.buildTree(preorder, inorder); });
+            cout << ", recursive with map " << recMs << " ms";
+        }
+        cout << endl;
+    }
+
+    return 0;
+}
+
+/*
+Time Complexity: O(N) where N is the number of nodes in the Binary Tree.
+Every value is pushed onto and popped from the stack at most once, and no map lookup is performed.
+
+Space Complexity: O(N) where N is the number of nodes in the Binary Tree.
+The node buffer holds N nodes, and the explicit stack holds at most H nodes where H is the height of the tree.
+As the stack lives on the heap, a skewed tree with H ~ N does not overflow the call stack.
+The buffer is owned by the returned Tree and released with it.
+*/
+
+//Parallel Divide and Conquer Approach :
+/*
+Algorithm / Intuition
+Once the position of the root in the inorder array is known, the left subtree and the right subtree are built from disjoint ranges of both arrays.
+Nothing the left call does is read or written by the right call, so the two calls can run at the same time on different cores.
+Two things are shared between the calls and both can be made contention free:
+The inorder position index is only read during the construction, so it is built once up front and shared by all the tasks without any locking.
+Node allocation: instead of one arena per thread, we reserve one buffer of N nodes and store the node created from preorder[i] at slot i.
+Every subtree owns a contiguous range of the preorder array, so every task writes to its own range of the buffer and no two tasks ever touch the same slot.
+The buffer is returned together with the root in a Tree that owns the nodes, so every tree built stays valid on its own.
+Spawning a task costs far more than building a small subtree, so a range is split into a new task only while it holds more than a threshold of nodes,
+and only up to a depth at which there are a few tasks per core. Below that the ordinary recursion runs on the current thread.
+
+Algorithm:
+Step 1: Build the inorder position index once (a flat array for dense values, an open addressing table otherwise) and reserve a buffer of N nodes.
+Step 2: Build the tree from the range (preStart, preEnd, inStart, inEnd) as in the recursive solution, creating the root at buffer slot preStart.
+Step 3: If the range holds more than the threshold nodes and the task depth is below the limit, build the left subtree in a new task, build the right subtree on the current thread and wait for the task.
+Otherwise build both subtrees recursively on the current thread.
+Step 4: Return the root at buffer slot 0.
+*/
+
+
+#include <iostream>
+#include <vector>
+#include <future>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <cstdint>
+
+using namespace std;
+
+// TreeNode structure
+struct TreeNode {
+    int val;
+    TreeNode *left;
+    TreeNode *right;
+    TreeNode(int x) : val(x), left(nullptr), right(nullptr) {}
+};
+
+// Position index of the inorder values, a flat
+// array for dense values and an open addressing
+// hash table otherwise
+class InorderIndex {
+public:
+    InorderIndex(const vector<int>& inorder){
+        int n = inorder.size();
+        if(n == 0){
+            return;
+        }
+        int minVal = *min_element(inorder.begin(), inorder.end());
+        int maxVal = *max_element(inorder.begin(), inorder.end());
+
+        // Dense values, index by value directly
+        if((int64_t)maxVal - minVal + 1 <= 4 * (int64_t)n){
+            dense = true;
+            base = minVal;
+            pos.assign((int64_t)maxVal - minVal + 1, -1);
+            for(int i = 0; i < n; i++){
+                pos[inorder[i] - base] = i;
+            }
+            return;
+        }
+
+        // Sparse values, open addressing with
+        // linear probing at load factor <= 0.5
+        dense = false;
+        size_t capacity = 1;
+        while(capacity < 2 * (size_t)n){
+            capacity <<= 1;
+        }
+        mask = capacity - 1;
+        keys.resize(capacity);
+        pos.assign(capacity, -1);
+        for(int i = 0; i < n; i++){
+            size_t slot = hash(inorder[i]);
+            while(pos[slot] != -1 && keys[slot] != inorder[i]){
+                slot = (slot + 1) & mask;
+            }
+            keys[slot] = inorder[i];
+            pos[slot] = i;
+        }
+    }
+
+    // Function to return the inorder
+    // index of 'value', or -1 if absent
+    int find(int value) const{
+        if(dense){
+            int64_t i = (int64_t)value - base;
+            return (i < 0 || i >= (int64_t)pos.size()) ? -1 : pos[i];
+        }
+        size_t slot = hash(value);
+        while(pos[slot] != -1){
+            if(keys[slot] == value){
+                return pos[slot];
+            }
+            slot = (slot + 1) & mask;
+        }
+        return -1;
+    }
+
+private:
+    // Multiplicative hash spreading
+    // the bits over the whole slot range
+    size_t hash(int value) const{
+        uint64_t h = (uint64_t)(uint32_t)value * 0x9E3779B97F4A7C15ull;
+        return (size_t)(h >> 32) & mask;
+    }
+
+    bool dense = true;
+    int base = 0;
+    size_t mask = 0;
+    vector<int> keys;
+    vector<int> pos;
+};
+
+// Tree whose nodes live in one contiguous buffer
+// owned by the tree. It can be moved but not
+// copied, as the nodes point into the buffer
+struct Tree {
+    vector<TreeNode> nodes;
+    TreeNode* root = NULL;
+
+    Tree() = default;
+    Tree(Tree&&) = default;
+    Tree& operator=(Tree&&) = default;
+    Tree(const Tree&) = delete;
+    Tree& operator=(const Tree&) = delete;
+};
+
+class Solution {
+public:
+    Solution(){
+        // Allow a few tasks per core
+        int cores = max(1u, thread::hardware_concurrency());
+        maxDepth = 2;
+        while((1 << maxDepth) < 4 * cores){
+            maxDepth++;
+        }
+    }
+
+    // Function to build a binary tree from preorder
+    // and inorder traversals using multiple threads
+    Tree buildTree(vector<int>& preorder, vector<int>& inorder){
+        Tree tree;
+        int n = preorder.size();
+        if(n == 0 || n != (int)inorder.size()){
+            return tree;
+        }
+
+        // Read-only index shared by all the tasks
+        InorderIndex index(inorder);
+
+        // Node of preorder[i] lives at nodes[i], so
+        // every task writes to its own range
+        tree.nodes.assign(preorder.begin(), preorder.end());
+
+        tree.root = buildTree(preorder, 0, n - 1, 0, n - 1, index, tree.nodes.data(), 0);
+        return tree;
+    }
+
+private:
+    // Recursive helper function to build the tree,
+    // spawning the left subtree as a separate task
+    // while the range is large enough
+    TreeNode* buildTree(vector<int>& preorder, int preStart, int preEnd,
+            int inStart, int inEnd, const InorderIndex& index, TreeNode* nodes, int depth){
+        // Base case: If the start indices
+        // exceed the end indices, return NULL
+        if(preStart > preEnd || inStart > inEnd){
+            return NULL;
+        }
+
+        // The node of the current root
+        // lives at its preorder index
+        TreeNode* root = &nodes[preStart];
+
+        // Find the index of the current root
+        // value in the inorder traversal
+        int inRoot = index.find(preorder[preStart]);
+
+        // Calculate the number of
+        // elements in the left subtree
+        int numsLeft = inRoot - inStart;
+
+        if(preEnd - preStart + 1 > threshold && depth < maxDepth){
+            // Build the left subtree in a new task
+            // while this thread builds the right one
+            future<TreeNode*> left = async(launch::async, [=, &preorder, &index]{
+                return buildTree(preorder, preStart + 1, preStart + numsLeft,
+                                inStart, inRoot - 1, index, nodes, depth + 1);
+            });
+            root->right = buildTree(preorder, preStart + numsLeft + 1, preEnd,
+                            inRoot + 1, inEnd, index, nodes, depth + 1);
+            root->left = left.get();
+        }
+        else{
+            root->left = buildTree(preorder, preStart + 1, preStart + numsLeft,
+                            inStart, inRoot - 1, index, nodes, depth);
+            root->right = buildTree(preorder, preStart + numsLeft + 1, preEnd,
+                            inRoot + 1, inEnd, index, nodes, depth);
+        }
+
+        // Return the current root node
+        return root;
+    }
+
+    // Ranges with at most this many nodes
+    // are built on the current thread
+    static const int threshold = 1 << 14;
+    int maxDepth = 0;
+};
+
+// Function to print the
+// inorder traversal of a tree
+void printInorder(TreeNode* root){
+    if(!root){
+        return;
+    }
+    printInorder(root->left);
+    cout << root->val << " ";
+    printInorder(root->right);
+}
+
+// Function to print the
+// given vector
+void printVector(vector<int>&vec){
+    for(int i = 0; i < (int)vec.size(); i++){
+        cout << vec[i] << " ";
+    }
+    cout << endl;
+}
+
+
+int main() {
+    vector<int> inorder = {9, 3, 15, 20, 7};
+    vector<int> preorder = {3, 9, 20, 15, 7};
+
+    cout << "Inorder Vector: ";
+    printVector(inorder);
+
+    cout << "Preorder Vector: ";
+    printVector(preorder);
+
+    Solution sol;
+
+    Tree tree = sol.buildTree(preorder, inorder);
+
+    cout << "Inorder of Unique Binary Tree Created: "<< endl;
+    printInorder(tree.root);
+    cout << endl;
+
+    // Time a perfectly balanced tree
+    // with values 0 ... n-1 in inorder
+    int n = (1 << 22) - 1;
+    inorder.resize(n);
+    preorder.clear();
+    for(int i = 0; i < n; i++){
+        inorder[i] = i;
+    }
+    vector<pair<int, int>> ranges = {{0, n - 1}};
+    while(!ranges.empty()){
+        int lo = ranges.back().first, hi = ranges.back().second;
+        ranges.pop_back();
+        if(lo > hi){
+            continue;
+        }
+        int mid = lo + (hi - lo) / 2;
+        preorder.push_back(mid);
+        ranges.push_back({mid + 1, hi});
+        ranges.push_back({lo, mid - 1});
+    }
+    auto start = chrono::steady_clock::now();
+    Tree big = sol.buildTree(preorder, inorder);
+    auto end = chrono::steady_clock::now();
+    cout << "Built " << n << " nodes on " << thread::hardware_concurrency() << " cores in "
+         << chrono::duration<double, milli>(end - start).count() << " ms" << endl;
+
+    return 0;
+}
+
+/*
+Time Complexity: O(N / P + H) where N is the number of nodes, P is the number of cores and H is the height of the Binary Tree.
+The total work is O(N) as in the recursive solution. When the splits are reasonably balanced the tasks divide this work evenly over the cores.
+The work done before the first split and along the spine of every task is bounded by the height of the tree.
+
+Space Complexity: O(N) where N is the number of nodes in the Binary Tree.
+The node buffer holds N nodes and the position index holds at most 4N entries. Every task uses recursion stack space proportional to the height of its subtree.
+The buffer is owned by the returned Tree and released with it.
+For deeply skewed trees the ranges are split unevenly, so the iterative stack based approach above is the better choice there.
+*/
+
+//Duplicate Values Approach :
+/*
+Algorithm / Intuition
+The solutions above locate the root inside the inorder array by its value. When a value occurs more than once, the map keeps only one of its positions,
+so the recursion splits the arrays at the wrong place and silently builds a tree that does not even reproduce the given traversals.
+With repeated values a pair of traversals can also describe several different trees, for example preorder [1, 1] and inorder [1, 1] fit both a left child and a right child.
+There are two ways to deal with this, and both can reuse the stack based construction since it never looks a value up:
+
+With ids: if every element carries a unique id next to its value, as (value, id) pairs, the stack based construction compares ids instead of values.
+The ids make every node distinguishable, so the original tree is rebuilt exactly, still in O(N) and without hashing anything.
+
+Without ids: the stack based construction compares values. When the top of the stack matches the next inorder value it treats them as the same node.
+With repeated values this guess can be wrong: the equal inorder value may belong to a node further down the left subtree, and the tree built then does not reproduce the traversals.
+So we check the tree it builds in O(N) and return an empty tree when the check fails, instead of a tree with the wrong traversals.
+Finding a matching tree in that case needs a search over the possible splits, which costs far more than O(N), so the values alone are only a best effort.
+The (value, id) version is the O(N) construction that is safe with repeated values, and callers that can number their elements should use it.
+
+Both versions share one template, which is told how to read the value and the matching key of an element. The nodes are returned in a Tree that owns their buffer.
+
+Algorithm:
+Step 1: If the arrays are empty or their sizes differ return an empty tree. Reserve a buffer of N nodes and create the root from the value of preorder[0]. Push it onto the stack together with the key of preorder[0] and set the inorder index to 0.
+Step 2: For every following preorder element:
+If the key on top of the stack does not match the key of inorder[index], create the element’s value as the left child of the top and push it.
+Otherwise, pop while the key on top of the stack matches the key of inorder[index], advancing index after every pop. Create the value as the right child of the last popped node and push it.
+Step 3: Return the root.
+Step 4: Without ids, walk the tree with an iterative inorder traversal, which pushes the nodes in preorder, and compare both orders with the input.
+If they differ, return an empty tree to report that the values alone could not be matched.
+*/
+
+
+#include <iostream>
+#include <vector>
+#include <utility>
+
+using namespace std;
+
+// TreeNode structure
+struct TreeNode {
+    int val;
+    TreeNode *left;
+    TreeNode *right;
+    TreeNode(int x) : val(x), left(nullptr), right(nullptr) {}
+};
+
+// Tree whose nodes live in one contiguous buffer
+// owned by the tree. It can be moved but not
+// copied, as the nodes point into the buffer
+struct Tree {
+    vector<TreeNode> nodes;
+    TreeNode* root = NULL;
+
+    Tree() = default;
+    Tree(Tree&&) = default;
+    Tree& operator=(Tree&&) = default;
+    Tree(const Tree&) = delete;
+    Tree& operator=(const Tree&) = delete;
+};
+
+class Solution {
+public:
+    // Function to build a binary tree from preorder and
+    // inorder traversals that may contain repeated values,
+    // returns a tree matching both traversals, or an empty
+    // tree if the repeated values misled the construction
+    Tree buildTree(vector<int>& preorder, vector<int>& inorder){
+        // Repeated values may mislead the stack
+        // based construction, check its result
+        Tree tree = build(preorder, inorder);
+        if(!matches(tree.root, preorder, inorder)){
+            return Tree();
+        }
+        return tree;
+    }
+
+    // Function to build a binary tree from preorder and
+    // inorder traversals of (value, id) pairs where the
+    // ids are unique, rebuilds the original tree exactly,
+    // this is the O(N) version safe with repeated values
+    Tree buildTree(vector<pair<int, int>>& preorder, vector<pair<int, int>>& inorder){
+        return build(preorder, inorder);
+    }
+
+private:
+    // Value stored in the node and key used
+    // to match the stack against inorder
+    static int valueOf(int v){ return v; }
+    static int keyOf(int v){ return v; }
+    static int valueOf(const pair<int, int>& p){ return p.first; }
+    static int keyOf(const pair<int, int>& p){ return p.second; }
+
+    // Stack based construction shared by both versions
+    template <typename T>
+    Tree build(const vector<T>& preorder, const vector<T>& inorder){
+        Tree tree;
+        int n = preorder.size();
+        if(n == 0 || n != (int)inorder.size()){
+            return tree;
+        }
+
+        // Reserve the whole buffer so the node
+        // addresses stay valid while we build
+        vector<TreeNode>& pool = tree.nodes;
+        pool.reserve(n);
+
+        // Stack of nodes whose right child is
+        // not decided yet, with their keys
+        vector<pair<TreeNode*, int>> st;
+        pool.emplace_back(valueOf(preorder[0]));
+        tree.root = &pool.back();
+        st.push_back({tree.root, keyOf(preorder[0])});
+
+        int in = 0;
+        for(int i = 1; i < n; i++){
+            TreeNode* node = st.back().first;
+            pool.emplace_back(valueOf(preorder[i]));
+            TreeNode* child = &pool.back();
+
+            if(st.back().second != keyOf(inorder[in])){
+                // The left subtree of the top
+                // is not finished yet
+                node->left = child;
+            }
+            else{
+                // Pop every node whose left subtree
+                // and itself are finished in inorder
+                while(!st.empty() && st.back().second == keyOf(inorder[in])){
+                    node = st.back().first;
+                    st.pop_back();
+                    in++;
+                }
+                // The next preorder value is the
+                // right child of the last popped node
+                node->right = child;
+            }
+            st.push_back({child, keyOf(preorder[i])});
+        }
+        return tree;
+    }
+
+    // Function to check that the tree rooted at
+    // 'root' has the given preorder and inorder
+    bool matches(TreeNode* root, const vector<int>& preorder, const vector<int>& inorder){
+        // An iterative inorder traversal pushes
+        // the nodes in preorder
+        vector<TreeNode*> st;
+        size_t p = 0, q = 0;
+        TreeNode* curr = root;
+        while(curr || !st.empty()){
+            while(curr){
+                if(p == preorder.size() || curr->val != preorder[p++]){
+                    return false;
+                }
+                st.push_back(curr);
+                curr = curr->left;
+            }
+            curr = st.back();
+            st.pop_back();
+            if(q == inorder.size() || curr->val != inorder[q++]){
+                return false;
+            }
+            curr = curr->right;
+        }
+        return p == preorder.size() && q == inorder.size();
+    }
+};
+
+// Function to print the
+// preorder traversal of a tree
+void printPreorder(TreeNode* root){
+    if(!root){
+        return;
+    }
+    cout << root->val << " ";
+    printPreorder(root->left);
+    printPreorder(root->right);
+}
+
+// Function to print the
+// inorder traversal of a tree
+void printInorder(TreeNode* root){
+    if(!root){
+        return;
+    }
+    printInorder(root->left);
+    cout << root->val << " ";
+    printInorder(root->right);
+}
+
+int main() {
+    /*
+    Tree with repeated values:
+            1
+           / \
+          2   1
+         /     \
+        1       2
+    */
+    vector<pair<int, int>> preorder = {{1, 0}, {2, 1}, {1, 2}, {1, 3}, {2, 4}};
+    vector<pair<int, int>> inorder = {{1, 2}, {2, 1}, {1, 0}, {1, 3}, {2, 4}};
+
+    Solution sol;
+
+    // Build with ids, this rebuilds
+    // the original tree exactly
+    Tree tree = sol.buildTree(preorder, inorder);
+
+    cout << "Tree built with ids, preorder: ";
+    printPreorder(tree.root);
+    cout << endl << "inorder: ";
+    printInorder(tree.root);
+    cout << endl;
+
+    // Build from the values alone, this returns
+    // a tree matching both traversals
+    vector<int> preValues = {1, 2, 1, 1, 2};
+    vector<int> inValues = {1, 2, 1, 1, 2};
+    tree = sol.buildTree(preValues, inValues);
+
+    cout << "Tree built from values, preorder: ";
+    printPreorder(tree.root);
+    cout << endl << "inorder: ";
+    printInorder(tree.root);
+    cout << endl;
+
+    /*
+    Here the repeated values mislead the construction:
+            1
+           /
+          3
+         /
+        1
+         \
+          2
+    the root matches the first inorder 1 and is popped too early,
+    so it reports the failure with an empty tree
+    */
+    vector<int> preMisled = {1, 3, 1, 2};
+    vector<int> inMisled = {1, 2, 3, 1};
+    tree = sol.buildTree(preMisled, inMisled);
+    cout << "Values that mislead the construction give "
+         << (tree.root == NULL ? "an empty tree" : "a tree") << endl;
+
+    return 0;
+}
+
+/*
+Time Complexity: O(N) where N is the number of nodes in the Binary Tree.
+Every element is pushed onto and popped from the stack at most once, and matching compares two integers without any hashing or map lookup. Checking the tree built from values alone is O(N) as well.
+
+Space Complexity: O(N) where N is the number of nodes in the Binary Tree.
+The node buffer holds N nodes, owned by the returned Tree, and the stack holds at most H entries where H is the height of the tree.
+No separate deduplication pass or index over the values is needed.
+*/
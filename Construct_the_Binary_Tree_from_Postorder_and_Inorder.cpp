@@ -166,4 +166,916 @@ In the worst case, the maximum depth of the recursion stack would be equal to th
 */
 
                             
-                        
\ No newline at end of file
+                        
+
+//Flat Index Approach :
+/*
+Algorithm / Intuition
+The recursive algorithm above is linear apart from one thing: building and querying the map of inorder positions.
+A std::map performs one allocation and O(log N) pointer chasing comparisons per entry, and for large inputs this dominates the whole construction.
+The lookup only ever asks "at which inorder index is this value", so we can use a cheaper structure depending on the values:
+If the values are dense, meaning they fit in a range [minVal, maxVal] not much larger than N, a plain array indexed by (value - minVal) answers every lookup with one memory access.
+Otherwise we use an open addressing hash table: one flat array of (key, index) slots with a power of two capacity of at least 2N, where collisions probe the next slot.
+Both structures are allocated once, so building the index costs O(N) with no per entry allocation.
+The nodes themselves are taken from one contiguous buffer reserved up front instead of calling new for every node. The buffer is returned together with the root in a Tree that owns the nodes.
+
+Algorithm:
+Step 1: Scan the inorder array for the minimum and maximum value. If (maxVal - minVal + 1) <= 4N, fill a flat array with pos[value - minVal] = index.
+Step 2: Otherwise, create a table with capacity = the smallest power of two >= 2N. For every inorder value, hash it and probe linearly until an empty slot is found, then store the value and its index.
+Step 3: Reserve a buffer of N nodes and run the recursive construction from above, using the flat index for the root lookup and the buffer for the new nodes.
+*/
+
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+using namespace std;
+
+// TreeNode structure
+struct TreeNode {
+    int val;
+    TreeNode *left;
+    TreeNode *right;
+    TreeNode(int x) : val(x), left(nullptr), right(nullptr) {}
+};
+
+// Position index of the inorder values, a flat
+// array for dense values and an open addressing
+// hash table otherwise
+class InorderIndex {
+public:
+    InorderIndex(const vector<int>& inorder){
+        int n = inorder.size();
+        if(n == 0){
+            return;
+        }
+        int minVal = *min_element(inorder.begin(), inorder.end());
+        int maxVal = *max_element(inorder.begin(), inorder.end());
+
+        // Dense values, index by value directly
+        if((int64_t)maxVal - minVal + 1 <= 4 * (int64_t)n){
+            dense = true;
+            base = minVal;
+            pos.assign((int64_t)maxVal - minVal + 1, -1);
+            for(int i = 0; i < n; i++){
+                pos[inorder[i] - base] = i;
+            }
+            return;
+        }
+
+        // Sparse values, open addressing with
+        // linear probing at load factor <= 0.5
+        dense = false;
+        size_t capacity = 1;
+        while(capacity < 2 * (size_t)n){
+            capacity <<= 1;
+        }
+        mask = capacity - 1;
+        keys.resize(capacity);
+        pos.assign(capacity, -1);
+        for(int i = 0; i < n; i++){
+            size_t slot = hash(inorder[i]);
+            while(pos[slot] != -1 && keys[slot] != inorder[i]){
+                slot = (slot + 1) & mask;
+            }
+            keys[slot] = inorder[i];
+            pos[slot] = i;
+        }
+    }
+
+    // Function to return the inorder
+    // index of 'value', or -1 if absent
+    int find(int value) const{
+        if(dense){
+            int64_t i = (int64_t)value - base;
+            return (i < 0 || i >= (int64_t)pos.size()) ? -1 : pos[i];
+        }
+        size_t slot = hash(value);
+        while(pos[slot] != -1){
+            if(keys[slot] == value){
+                return pos[slot];
+            }
+            slot = (slot + 1) & mask;
+        }
+        return -1;
+    }
+
+private:
+    // Multiplicative hash spreading
+    // the bits over the whole slot range
+    size_t hash(int value) const{
+        uint64_t h = (uint64_t)(uint32_t)value * 0x9E3779B97F4A7C15ull;
+        return (size_t)(h >> 32) & mask;
+    }
+
+    bool dense = true;
+    int base = 0;
+    size_t mask = 0;
+    vector<int> keys;
+    vector<int> pos;
+};
+
+// Tree whose nodes live in one contiguous buffer
+// owned by the tree. It can be moved but not
+// copied, as the nodes point into the buffer
+struct Tree {
+    vector<TreeNode> nodes;
+    TreeNode* root = NULL;
+
+    Tree() = default;
+    Tree(Tree&&) = default;
+    Tree& operator=(Tree&&) = default;
+    Tree(const Tree&) = delete;
+    Tree& operator=(const Tree&) = delete;
+};
+
+class Solution {
+public:
+    // Function to build a binary tree
+    // from inorder and postorder traversals
+    Tree buildTree(vector<int>& inorder, vector<int>& postorder) {
+        Tree tree;
+        if (inorder.size() != postorder.size()) {
+            return tree;
+        }
+
+        // Build the flat position index
+        // of the inorder values once
+        InorderIndex index(inorder);
+
+        // Reserve the whole buffer so the node
+        // addresses stay valid while we build
+        tree.nodes.reserve(inorder.size());
+
+        // Call the recursive function
+        // to build the binary tree
+        tree.root = buildTreePostIn(0, inorder.size() - 1, postorder, 0,
+            postorder.size() - 1, index, tree.nodes);
+        return tree;
+    }
+
+private:
+    // Recursive function to build a binary
+    // tree from inorder and postorder traversals
+    TreeNode* buildTreePostIn(int is, int ie, vector<int>& postorder,
+        int ps, int pe, const InorderIndex& index, vector<TreeNode>& pool) {
+
+        // Base case: If the subtree
+        // is empty, return NULL
+        if (ps > pe || is > ie) {
+            return NULL;
+        }
+
+        // Take the root node from the buffer
+        // with the root value from postorder
+        pool.emplace_back(postorder[pe]);
+        TreeNode* root = &pool.back();
+
+        // Find the index of the root
+        // value in inorder traversal
+        int inRoot = index.find(postorder[pe]);
+
+        // Number of nodes in the left subtree
+        int numsLeft = inRoot - is;
+
+        // Recursively build the
+        // left and right subtrees
+        root->left = buildTreePostIn(is, inRoot - 1, postorder,
+            ps, ps + numsLeft - 1, index, pool);
+
+        root->right = buildTreePostIn(inRoot + 1, ie, postorder,
+            ps + numsLeft, pe - 1, index, pool);
+
+        // Return the root of
+        // the constructed subtree
+        return root;
+    }
+};
+
+// Function to print the
+// inorder traversal of a tree
+void printInorder(TreeNode* root) {
+    if (!root) {
+        return;
+    }
+    printInorder(root->left);
+    cout << root->val << " ";
+    printInorder(root->right);
+}
+
+// Function to print the given vector
+void printVector(vector<int>& vec) {
+    for (int i = 0; i < (int)vec.size(); i++) {
+        cout << vec[i] << " ";
+    }
+    cout << endl;
+}
+
+int main() {
+    Solution sol;
+
+    // Dense values use the flat array,
+    // sparse values use the hash table
+    vector<vector<int>> inorders = {
+        {40, 20, 50, 10, 60, 30},
+        {-400000000, 2000000000, 50, 1000000000, 60, 30}
+    };
+    vector<vector<int>> postorders = {
+        {40, 50, 20, 60, 30, 10},
+        {-400000000, 50, 2000000000, 60, 30, 1000000000}
+    };
+
+    for (int t = 0; t < (int)inorders.size(); t++) {
+        // Display the input vectors
+        cout << "Inorder Vector: ";
+        printVector(inorders[t]);
+
+        cout << "Postorder Vector: ";
+        printVector(postorders[t]);
+
+        // Build the binary tree and
+        // print its inorder traversal
+        Tree tree = sol.buildTree(inorders[t], postorders[t]);
+
+        cout << "Inorder of Unique Binary Tree Created: " << endl;
+        printInorder(tree.root);
+        cout << endl << endl;
+    }
+
+    return 0;
+}
+
+/*
+Time Complexity: O(N) where N is the number of nodes in the Binary Tree.
+Building the flat array or the hash table takes O(N), and every lookup is O(1), expected O(1) for the hash table as its load factor stays at most 0.5.
+
+Space Complexity: O(N) where N is the number of nodes in the Binary Tree.
+The flat array holds at most 4N entries and the hash table at most 4N slots, plus the buffer of N nodes owned by the returned Tree.
+The recursion stack still uses O(H) space where H is the height of the tree, see the iterative approach below for skewed trees.
+*/
+
+//Iterative Stack Based Approach :
+/*
+Algorithm / Intuition
+We can avoid value lookups altogether by walking the postorder and inorder arrays backwards.
+Reading postorder from the end gives the nodes in the order root, right subtree, left subtree, and reading inorder from the end gives right subtree, root, left subtree.
+This is the mirror image of the preorder and inorder pair, so the stack based construction from Construct Binary Tree from Inorder and Preorder works with left and right swapped.
+While the node we last created is not the next node of the reversed inorder, the next reversed postorder value must be its right child.
+Once the top of the stack matches the reversed inorder, the right subtree of that node is finished. We pop the nodes while they match, and the next value becomes the left child of the last popped node.
+The nodes are allocated from one contiguous buffer, so the whole construction needs neither a map nor one allocation per node, and it never recurses.
+The buffer is returned together with the root in a Tree that owns the nodes, so a tree stays valid however many other trees the same Solution builds.
+
+Algorithm:
+Step 1: If the arrays are empty or their sizes differ return an empty tree. Reserve a buffer of N nodes and create the root from postorder[N-1]. Push it onto the stack and set the inorder index to N-1.
+Step 2: For every postorder value from index N-2 down to 0:
+If the top of the stack does not match inorder[index], create the value as the right child of the top and push it.
+Otherwise, pop nodes while the top of the stack matches inorder[index], decrementing index after every pop. Create the value as the left child of the last popped node and push it.
+Step 3: Return the tree holding the buffer and the root.
+*/
+
+
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+// TreeNode structure
+struct TreeNode {
+    int val;
+    TreeNode *left;
+    TreeNode *right;
+    TreeNode(int x) : val(x), left(nullptr), right(nullptr) {}
+};
+
+// Tree whose nodes live in one contiguous buffer
+// owned by the tree. It can be moved but not
+// copied, as the nodes point into the buffer
+struct Tree {
+    vector<TreeNode> nodes;
+    TreeNode* root = NULL;
+
+    Tree() = default;
+    Tree(Tree&&) = default;
+    Tree& operator=(Tree&&) = default;
+    Tree(const Tree&) = delete;
+    Tree& operator=(const Tree&) = delete;
+};
+
+class Solution {
+public:
+    // Function to build a binary tree from inorder
+    // and postorder traversals without recursion
+    Tree buildTree(vector<int>& inorder, vector<int>& postorder) {
+        Tree tree;
+        int n = postorder.size();
+        if (n == 0 || n != (int)inorder.size()) {
+            return tree;
+        }
+
+        // Reserve the whole buffer so the node
+        // addresses stay valid while we build
+        vector<TreeNode>& pool = tree.nodes;
+        pool.reserve(n);
+
+        // Stack of nodes whose left
+        // child is not decided yet
+        vector<TreeNode*> st;
+        pool.emplace_back(postorder[n - 1]);
+        tree.root = &pool.back();
+        st.push_back(tree.root);
+
+        int in = n - 1;
+        for (int i = n - 2; i >= 0; i--) {
+            TreeNode* node = st.back();
+            pool.emplace_back(postorder[i]);
+            TreeNode* child = &pool.back();
+
+            if (node->val != inorder[in]) {
+                // The right subtree of the top
+                // is not finished yet
+                node->right = child;
+            }
+            else {
+                // Pop every node whose right subtree
+                // and itself are finished in inorder
+                while (!st.empty() && st.back()->val == inorder[in]) {
+                    node = st.back();
+                    st.pop_back();
+                    in--;
+                }
+                // The next value is the left
+                // child of the last popped node
+                node->left = child;
+            }
+            st.push_back(child);
+        }
+        return tree;
+    }
+};
+
+// Function to print the
+// inorder traversal of a tree
+void printInorder(TreeNode* root) {
+    if (!root) {
+        return;
+    }
+    printInorder(root->left);
+    cout << root->val << " ";
+    printInorder(root->right);
+}
+
+// Function to print the given vector
+void printVector(vector<int>& vec) {
+    for (int i = 0; i < (int)vec.size(); i++) {
+        cout << vec[i] << " ";
+    }
+    cout << endl;
+}
+
+int main() {
+    // Example input vectors
+    vector<int> inorder = {40, 20, 50, 10, 60, 30};
+    vector<int> postorder = {40, 50, 20, 60, 30, 10};
+
+    // Display the input vectors
+    cout << "Inorder Vector: ";
+    printVector(inorder);
+
+    cout << "Postorder Vector: ";
+    printVector(postorder);
+
+    Solution sol;
+
+    // Build the binary tree and
+    // print its inorder traversal
+    Tree tree = sol.buildTree(inorder, postorder);
+
+    cout << "Inorder of Unique Binary Tree Created: " << endl;
+    printInorder(tree.root);
+    cout << endl;
+
+    return 0;
+}
+
+/*
+Time Complexity: O(N) where N is the number of nodes in the Binary Tree.
+Every node is pushed onto and popped from the stack at most once and no value lookup is performed.
+
+Space Complexity: O(N) where N is the number of nodes in the Binary Tree.
+The node buffer holds N nodes and the explicit stack holds at most H nodes where H is the height of the tree. There is no recursion, so skewed trees do not overflow the call stack.
+The buffer is owned by the returned Tree and released with it.
+*/
+
+//Parallel Divide and Conquer Approach :
+/*
+Algorithm / Intuition
+This follows the parallel construction from Construct Binary Tree from Inorder and Preorder.
+After the root is located in the inorder array, the left subtree is built from postorder[ps .. ps + numsLeft - 1] and the right subtree from postorder[ps + numsLeft .. pe - 1].
+The two ranges are disjoint, so the left subtree is built in a separate task while the current thread builds the right subtree.
+The inorder position index is built once and only read by the tasks.
+The node created from postorder[i] is stored at slot i of one preallocated buffer, so every task writes only to the slots of its own postorder range and node allocation needs no lock.
+The buffer is returned together with the root in a Tree that owns the nodes, so every tree built stays valid on its own.
+Ranges holding at most a threshold of nodes, or deeper than a few tasks per core, are built on the current thread.
+
+Algorithm:
+Step 1: Build the inorder position index and reserve a buffer of N nodes.
+Step 2: Build the tree from the range (is, ie, ps, pe) as in the recursive solution, creating the root at buffer slot pe.
+Step 3: If the range holds more than the threshold nodes and the task depth is below the limit, build the left subtree in a new task and the right subtree on the current thread, then wait for the task.
+Otherwise build both subtrees on the current thread.
+Step 4: Return the root at buffer slot N-1.
+*/
+
+
+#include <iostream>
+#include <vector>
+#include <future>
+#include <thread>
+#include <algorithm>
+#include <cstdint>
+
+using namespace std;
+
+// TreeNode structure
+struct TreeNode {
+    int val;
+    TreeNode *left;
+    TreeNode *right;
+    TreeNode(int x) : val(x), left(nullptr), right(nullptr) {}
+};
+
+// Position index of the inorder values, a flat
+// array for dense values and an open addressing
+// hash table otherwise
+class InorderIndex {
+public:
+    InorderIndex(const vector<int>& inorder){
+        int n = inorder.size();
+        if(n == 0){
+            return;
+        }
+        int minVal = *min_element(inorder.begin(), inorder.end());
+        int maxVal = *max_element(inorder.begin(), inorder.end());
+
+        // Dense values, index by value directly
+        if((int64_t)maxVal - minVal + 1 <= 4 * (int64_t)n){
+            dense = true;
+            base = minVal;
+            pos.assign((int64_t)maxVal - minVal + 1, -1);
+            for(int i = 0; i < n; i++){
+                pos[inorder[i] - base] = i;
+            }
+            return;
+        }
+
+        // Sparse values, open addressing with
+        // linear probing at load factor <= 0.5
+        dense = false;
+        size_t capacity = 1;
+        while(capacity < 2 * (size_t)n){
+            capacity <<= 1;
+        }
+        mask = capacity - 1;
+        keys.resize(capacity);
+        pos.assign(capacity, -1);
+        for(int i = 0; i < n; i++){
+            size_t slot = hash(inorder[i]);
+            while(pos[slot] != -1 && keys[slot] != inorder[i]){
+                slot = (slot + 1) & mask;
+            }
+            keys[slot] = inorder[i];
+            pos[slot] = i;
+        }
+    }
+
+    // Function to return the inorder
+    // index of 'value', or -1 if absent
+    int find(int value) const{
+        if(dense){
+            int64_t i = (int64_t)value - base;
+            return (i < 0 || i >= (int64_t)pos.size()) ? -1 : pos[i];
+        }
+        size_t slot = hash(value);
+        while(pos[slot] != -1){
+            if(keys[slot] == value){
+                return pos[slot];
+            }
+            slot = (slot + 1) & mask;
+        }
+        return -1;
+    }
+
+private:
+    // Multiplicative hash spreading
+    // the bits over the whole slot range
+    size_t hash(int value) const{
+        uint64_t h = (uint64_t)(uint32_t)value * 0x9E3779B97F4A7C15ull;
+        return (size_t)(h >> 32) & mask;
+    }
+
+    bool dense = true;
+    int base = 0;
+    size_t mask = 0;
+    vector<int> keys;
+    vector<int> pos;
+};
+
+// Tree whose nodes live in one contiguous buffer
+// owned by the tree. It can be moved but not
+// copied, as the nodes point into the buffer
+struct Tree {
+    vector<TreeNode> nodes;
+    TreeNode* root = NULL;
+
+    Tree() = default;
+    Tree(Tree&&) = default;
+    Tree& operator=(Tree&&) = default;
+    Tree(const Tree&) = delete;
+    Tree& operator=(const Tree&) = delete;
+};
+
+class Solution {
+public:
+    Solution() {
+        // Allow a few tasks per core
+        int cores = max(1u, thread::hardware_concurrency());
+        maxDepth = 2;
+        while ((1 << maxDepth) < 4 * cores) {
+            maxDepth++;
+        }
+    }
+
+    // Function to build a binary tree from inorder and
+    // postorder traversals using multiple threads
+    Tree buildTree(vector<int>& inorder, vector<int>& postorder) {
+        Tree tree;
+        int n = postorder.size();
+        if (n == 0 || n != (int)inorder.size()) {
+            return tree;
+        }
+
+        // Read-only index shared by all the tasks
+        InorderIndex index(inorder);
+
+        // Node of postorder[i] lives at nodes[i], so
+        // every task writes to its own range
+        tree.nodes.assign(postorder.begin(), postorder.end());
+
+        tree.root = buildTreePostIn(0, n - 1, postorder, 0, n - 1, index,
+            tree.nodes.data(), 0);
+        return tree;
+    }
+
+private:
+    // Recursive function to build a binary tree from
+    // inorder and postorder traversals, spawning the
+    // left subtree as a separate task while the
+    // range is large enough
+    TreeNode* buildTreePostIn(int is, int ie, vector<int>& postorder,
+        int ps, int pe, const InorderIndex& index, TreeNode* nodes, int depth) {
+
+        // Base case: If the subtree
+        // is empty, return NULL
+        if (ps > pe || is > ie) {
+            return NULL;
+        }
+
+        // The node of the current root
+        // lives at its postorder index
+        TreeNode* root = &nodes[pe];
+
+        // Find the index of the root
+        // value in inorder traversal
+        int inRoot = index.find(postorder[pe]);
+
+        // Number of nodes in the left subtree
+        int numsLeft = inRoot - is;
+
+        if (pe - ps + 1 > threshold && depth < maxDepth) {
+            // Build the left subtree in a new task
+            // while this thread builds the right one
+            future<TreeNode*> left = async(launch::async, [=, &postorder, &index] {
+                return buildTreePostIn(is, inRoot - 1, postorder,
+                    ps, ps + numsLeft - 1, index, nodes, depth + 1);
+            });
+            root->right = buildTreePostIn(inRoot + 1, ie, postorder,
+                ps + numsLeft, pe - 1, index, nodes, depth + 1);
+            root->left = left.get();
+        }
+        else {
+            root->left = buildTreePostIn(is, inRoot - 1, postorder,
+                ps, ps + numsLeft - 1, index, nodes, depth);
+            root->right = buildTreePostIn(inRoot + 1, ie, postorder,
+                ps + numsLeft, pe - 1, index, nodes, depth);
+        }
+
+        // Return the root of
+        // the constructed subtree
+        return root;
+    }
+
+    // Ranges with at most this many nodes
+    // are built on the current thread
+    static const int threshold = 1 << 14;
+    int maxDepth = 0;
+};
+
+// Function to print the
+// inorder traversal of a tree
+void printInorder(TreeNode* root) {
+    if (!root) {
+        return;
+    }
+    printInorder(root->left);
+    cout << root->val << " ";
+    printInorder(root->right);
+}
+
+// Function to print the given vector
+void printVector(vector<int>& vec) {
+    for (int i = 0; i < (int)vec.size(); i++) {
+        cout << vec[i] << " ";
+    }
+    cout << endl;
+}
+
+int main() {
+    // Example input vectors
+    vector<int> inorder = {40, 20, 50, 10, 60, 30};
+    vector<int> postorder = {40, 50, 20, 60, 30, 10};
+
+    // Display the input vectors
+    cout << "Inorder Vector: ";
+    printVector(inorder);
+
+    cout << "Postorder Vector: ";
+    printVector(postorder);
+
+    Solution sol;
+
+    // Build the binary tree and
+    // print its inorder traversal
+    Tree tree = sol.buildTree(inorder, postorder);
+
+    cout << "Inorder of Unique Binary Tree Created: " << endl;
+    printInorder(tree.root);
+    cout << endl;
+
+    return 0;
+}
+
+/*
+Time Complexity: O(N / P + H) where N is the number of nodes, P is the number of cores and H is the height of the Binary Tree.
+The total work is O(N), and with reasonably balanced splits it is divided evenly over the tasks.
+
+Space Complexity: O(N) where N is the number of nodes in the Binary Tree.
+The node buffer holds N nodes and the position index at most 4N entries. Each task uses recursion stack space proportional to the height of its subtree.
+The buffer is owned by the returned Tree and released with it.
+*/
+
+//Duplicate Values Approach :
+/*
+Algorithm / Intuition
+With repeated values the map from value to inorder index keeps only one position per value, so the recursive solution splits the arrays at the wrong place and builds a wrong tree.
+As explained for Construct Binary Tree from Inorder and Preorder, the stack based construction never looks a value up and can match elements by any key.
+If the elements are (value, id) pairs with unique ids, we match by id and the original tree is rebuilt exactly.
+If only values are given, we match by value. With repeated values this can pick the wrong node as the end of a subtree, so the tree built is checked against both traversals in O(N),
+and if the check fails we return an empty tree rather than a tree with the wrong traversals.
+The values alone are a best effort: the (value, id) version is the O(N) construction that is safe with repeated values.
+Here the construction walks postorder and inorder from the end, filling right children first. The nodes are returned in a Tree that owns their buffer.
+
+Algorithm:
+Step 1: If the arrays are empty or their sizes differ return an empty tree. Reserve a buffer of N nodes and create the root from the value of postorder[N-1]. Push it with its key and set the inorder index to N-1.
+Step 2: For every postorder element from index N-2 down to 0:
+If the key on top of the stack does not match the key of inorder[index], create the value as the right child of the top and push it.
+Otherwise, pop while the key on top of the stack matches the key of inorder[index], decrementing index after every pop. Create the value as the left child of the last popped node and push it.
+Step 3: Return the root.
+Step 4: Without ids, walk the tree with an iterative inorder traversal from the right, which pushes the nodes in reversed postorder, and compare both orders with the input.
+If they differ, return an empty tree to report that the values alone could not be matched.
+*/
+
+
+#include <iostream>
+#include <vector>
+#include <utility>
+
+using namespace std;
+
+// TreeNode structure
+struct TreeNode {
+    int val;
+    TreeNode *left;
+    TreeNode *right;
+    TreeNode(int x) : val(x), left(nullptr), right(nullptr) {}
+};
+
+// Tree whose nodes live in one contiguous buffer
+// owned by the tree. It can be moved but not
+// copied, as the nodes point into the buffer
+struct Tree {
+    vector<TreeNode> nodes;
+    TreeNode* root = NULL;
+
+    Tree() = default;
+    Tree(Tree&&) = default;
+    Tree& operator=(Tree&&) = default;
+    Tree(const Tree&) = delete;
+    Tree& operator=(const Tree&) = delete;
+};
+
+class Solution {
+public:
+    // Function to build a binary tree from inorder and
+    // postorder traversals that may contain repeated values,
+    // returns a tree matching both traversals, or an empty
+    // tree if the repeated values misled the construction
+    Tree buildTree(vector<int>& inorder, vector<int>& postorder) {
+        // Repeated values may mislead the stack
+        // based construction, check its result
+        Tree tree = build(inorder, postorder);
+        if (!matches(tree.root, inorder, postorder)) {
+            return Tree();
+        }
+        return tree;
+    }
+
+    // Function to build a binary tree from inorder and
+    // postorder traversals of (value, id) pairs where the
+    // ids are unique, rebuilds the original tree exactly,
+    // this is the O(N) version safe with repeated values
+    Tree buildTree(vector<pair<int, int>>& inorder, vector<pair<int, int>>& postorder) {
+        return build(inorder, postorder);
+    }
+
+private:
+    // Value stored in the node and key used
+    // to match the stack against inorder
+    static int valueOf(int v){ return v; }
+    static int keyOf(int v){ return v; }
+    static int valueOf(const pair<int, int>& p){ return p.first; }
+    static int keyOf(const pair<int, int>& p){ return p.second; }
+
+    // Stack based construction shared by both versions
+    template <typename T>
+    Tree build(const vector<T>& inorder, const vector<T>& postorder) {
+        Tree tree;
+        int n = postorder.size();
+        if (n == 0 || n != (int)inorder.size()) {
+            return tree;
+        }
+
+        // Reserve the whole buffer so the node
+        // addresses stay valid while we build
+        vector<TreeNode>& pool = tree.nodes;
+        pool.reserve(n);
+
+        // Stack of nodes whose left child is
+        // not decided yet, with their keys
+        vector<pair<TreeNode*, int>> st;
+        pool.emplace_back(valueOf(postorder[n - 1]));
+        tree.root = &pool.back();
+        st.push_back({tree.root, keyOf(postorder[n - 1])});
+
+        int in = n - 1;
+        for (int i = n - 2; i >= 0; i--) {
+            TreeNode* node = st.back().first;
+            pool.emplace_back(valueOf(postorder[i]));
+            TreeNode* child = &pool.back();
+
+            if (st.back().second != keyOf(inorder[in])) {
+                // The right subtree of the top
+                // is not finished yet
+                node->right = child;
+            }
+            else {
+                // Pop every node whose right subtree
+                // and itself are finished in inorder
+                while (!st.empty() && st.back().second == keyOf(inorder[in])) {
+                    node = st.back().first;
+                    st.pop_back();
+                    in--;
+                }
+                // The next value is the left
+                // child of the last popped node
+                node->left = child;
+            }
+            st.push_back({child, keyOf(postorder[i])});
+        }
+        return tree;
+    }
+
+    // Function to check that the tree rooted at
+    // 'root' has the given inorder and postorder
+    bool matches(TreeNode* root, const vector<int>& inorder, const vector<int>& postorder) {
+        // An iterative inorder traversal from the right
+        // pushes the nodes in reversed postorder
+        vector<TreeNode*> st;
+        size_t p = postorder.size(), q = inorder.size();
+        TreeNode* curr = root;
+        while (curr || !st.empty()) {
+            while (curr) {
+                if (p == 0 || curr->val != postorder[--p]) {
+                    return false;
+                }
+                st.push_back(curr);
+                curr = curr->right;
+            }
+            curr = st.back();
+            st.pop_back();
+            if (q == 0 || curr->val != inorder[--q]) {
+                return false;
+            }
+            curr = curr->left;
+        }
+        return p == 0 && q == 0;
+    }
+};
+
+// Function to print the
+// preorder traversal of a tree
+void printPreorder(TreeNode* root){
+    if(!root){
+        return;
+    }
+    cout << root->val << " ";
+    printPreorder(root->left);
+    printPreorder(root->right);
+}
+
+// Function to print the
+// inorder traversal of a tree
+void printInorder(TreeNode* root){
+    if(!root){
+        return;
+    }
+    printInorder(root->left);
+    cout << root->val << " ";
+    printInorder(root->right);
+}
+
+int main() {
+    /*
+    Tree with repeated values:
+            1
+           / \
+          2   1
+         /     \
+        1       2
+    */
+    vector<pair<int, int>> inorder = {{1, 2}, {2, 1}, {1, 0}, {1, 3}, {2, 4}};
+    vector<pair<int, int>> postorder = {{1, 2}, {2, 1}, {2, 4}, {1, 3}, {1, 0}};
+
+    Solution sol;
+
+    // Build with ids, this rebuilds
+    // the original tree exactly
+    Tree tree = sol.buildTree(inorder, postorder);
+
+    cout << "Tree built with ids, preorder: ";
+    printPreorder(tree.root);
+    cout << endl << "inorder: ";
+    printInorder(tree.root);
+    cout << endl;
+
+    // Build from the values alone, this returns
+    // a tree matching both traversals
+    vector<int> inValues = {1, 2, 1, 1, 2};
+    vector<int> postValues = {1, 2, 2, 1, 1};
+    tree = sol.buildTree(inValues, postValues);
+
+    cout << "Tree built from values, preorder: ";
+    printPreorder(tree.root);
+    cout << endl << "inorder: ";
+    printInorder(tree.root);
+    cout << endl;
+
+    /*
+    Here the repeated values mislead the construction:
+            1
+             \
+              3
+               \
+                1
+               /
+              2
+    the root matches the last inorder 1 and is popped too early,
+    so it reports the failure with an empty tree
+    */
+    vector<int> inMisled = {1, 3, 2, 1};
+    vector<int> postMisled = {2, 1, 3, 1};
+    tree = sol.buildTree(inMisled, postMisled);
+    cout << "Values that mislead the construction give "
+         << (tree.root == NULL ? "an empty tree" : "a tree") << endl;
+
+    return 0;
+}
+
+/*
+Time Complexity: O(N) where N is the number of nodes in the Binary Tree.
+Every element is pushed onto and popped from the stack at most once, and matching compares two integers without any hashing or map lookup. Checking the tree built from values alone is O(N) as well.
+
+Space Complexity: O(N) where N is the number of nodes in the Binary Tree.
+The node buffer holds N nodes, owned by the returned Tree, and the stack holds at most H entries where H is the height of the tree.
+No separate deduplication pass or index over the values is needed.
+*/
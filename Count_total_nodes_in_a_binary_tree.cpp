@@ -266,4 +266,212 @@ Space Complexity : O(H) ~ O(N) where N is the number of nodes in the Binary Tree
 The space complexity is determined by the maximum depth of the recursion stack, which is equal to the height of the binary tree.
 Since the given tree is a complete binary tree, the height will always be log N.
 Therefore, the space complexity is O(log N).
-*/
\ No newline at end of file
+*/
+
+//Binary Search on the Last Level Approach :
+/*
+Algorithm / Intuition
+The optimal approach above still walks both the leftmost and the rightmost path again at every level of the recursion, so a lot of the height computations are repeated.
+We can do better by remembering that in a Complete Binary Tree the left height of a subtree never has to be recomputed: the left height of the left child is always one less than that of its parent.
+
+Let h be the left height of the current subtree. Look at the left height of its right child:
+If it is h - 1, the last level reaches into the right subtree, so the left subtree is a perfect tree of height h - 1 holding 2^(h-1) - 1 nodes. Together with the root that is 2^(h-1) nodes, and we continue in the right subtree with height h - 1.
+Otherwise the last level ends inside the left subtree, so the right subtree is a perfect tree of height h - 2 holding 2^(h-2) - 1 nodes. Together with the root that is 2^(h-2) nodes, and we continue in the left subtree whose height we already know is h - 1.
+Every step halves the range of the last level where the final node can be, so this is a binary search on the last level.
+There are h steps and each of them walks one leftmost path of length at most h, so the count takes O(log N * log N) time without recursion.
+
+The binary search is only valid if the tree really is complete, and checking that needs to visit every node, which would cost as much as counting them.
+Comparing the leftmost and rightmost paths is not enough: a root whose left child has only a right child has paths of lengths 3 and 2 but is not complete.
+So the binary search is offered as `countCompleteTree`, which the caller may only use on a tree known to be complete, as the problem guarantees.
+`countNodes` stays the O(N) iterative counter that is correct for any binary tree.
+
+Algorithm:
+Step 1: Find the left height h of the root by walking the leftmost path.
+Step 2: While h > 0:
+Find the left height of the right child.
+If it equals h - 1, add 2^(h-1) to the count and move to the right child.
+Otherwise add 2^(h-2) to the count and move to the left child.
+Decrease h by one.
+Step 3: Return the count.
+Step 4: For a tree that may not be complete, count every node with an iterative traversal instead.
+*/
+
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+
+using namespace std;
+
+// TreeNode structure
+struct TreeNode {
+    int val;
+    TreeNode *left;
+    TreeNode *right;
+    TreeNode(int x) : val(x), left(nullptr), right(nullptr) {}
+};
+
+class Solution {
+public:
+    // Function to count the nodes of any binary tree
+    long long countNodes(TreeNode* root) {
+        return countAll(root);
+    }
+
+    // Function to count the nodes of a binary tree in
+    // O(log N * log N), the tree must be complete,
+    // otherwise the result is wrong
+    long long countCompleteTree(TreeNode* root) {
+        return countComplete(root, findHeightLeft(root));
+    }
+
+    // Function to count the nodes of a complete binary
+    // tree whose left height 'h' is already known
+    long long countComplete(TreeNode* node, int h) {
+        long long count = 0;
+        while (h > 0) {
+            if (findHeightLeft(node->right) == h - 1) {
+                // Left subtree is perfect with height
+                // h - 1, count it with the root and
+                // continue in the right subtree
+                count += 1LL << (h - 1);
+                node = node->right;
+            }
+            else {
+                // Right subtree is perfect with height
+                // h - 2, count it with the root and
+                // continue in the left subtree
+                count += 1LL << (h - 2);
+                node = node->left;
+            }
+            h--;
+        }
+        return count;
+    }
+
+    // Function to count the nodes of any
+    // binary tree iteratively in O(N)
+    long long countAll(TreeNode* root) {
+        long long count = 0;
+        vector<TreeNode*> st;
+        if (root) {
+            st.push_back(root);
+        }
+        while (!st.empty()) {
+            TreeNode* node = st.back();
+            st.pop_back();
+            count++;
+            if (node->left) {
+                st.push_back(node->left);
+            }
+            if (node->right) {
+                st.push_back(node->right);
+            }
+        }
+        return count;
+    }
+
+    // Function to find the left height of a tree
+    int findHeightLeft(TreeNode* node) {
+        int height = 0;
+        // Traverse left child until
+        // reaching the leftmost leaf
+        while (node) {
+            height++;
+            node = node->left;
+        }
+        return height;
+    }
+};
+
+// Brute force counter from
+// above, used as the baseline
+void inorder(TreeNode* root, long long &count) {
+    if (root == NULL) {
+        return;
+    }
+    count++;
+    inorder(root->left, count);
+    inorder(root->right, count);
+}
+
+// Function to build a complete binary tree with
+// n nodes in one buffer, node i has the children
+// 2i + 1 and 2i + 2 as in an array based heap
+TreeNode* buildComplete(vector<TreeNode>& nodes, long long n) {
+    nodes.assign(n, TreeNode(0));
+    for (long long i = 0; i < n; i++) {
+        nodes[i].val = i;
+        if (2 * i + 1 < n) {
+            nodes[i].left = &nodes[2 * i + 1];
+        }
+        if (2 * i + 2 < n) {
+            nodes[i].right = &nodes[2 * i + 2];
+        }
+    }
+    return n > 0 ? &nodes[0] : NULL;
+}
+
+int main() {
+    // Create the binary tree
+    TreeNode* root = new TreeNode(1);
+    root->left = new TreeNode(2);
+    root->right = new TreeNode(3);
+    root->left->left = new TreeNode(4);
+    root->left->right = new TreeNode(5);
+    root->right->left = new TreeNode(6);
+
+    Solution sol;
+
+    // Call the countCompleteTree function,
+    // the tree above is complete
+    long long totalNodes = sol.countCompleteTree(root);
+
+    // Print the result
+    cout << "Total number of nodes in the Complete Binary Tree: "
+            << totalNodes << endl;
+
+    // A tree that is not complete although its
+    // rightmost path is one shorter than its
+    // leftmost path is counted with countNodes
+    TreeNode* other = new TreeNode(1);
+    other->left = new TreeNode(2);
+    other->right = new TreeNode(3);
+    other->left->right = new TreeNode(4);
+    cout << "Total number of nodes in a tree that is not complete: "
+            << sol.countNodes(other) << endl;
+
+    // Benchmark on complete trees of 2^k nodes,
+    // raise maxLog to 30 on a machine with enough
+    // memory for 2^30 nodes (about 24 GB)
+    int maxLog = 22;
+    vector<TreeNode> nodes;
+    for (int k = 20; k <= maxLog; k++) {
+        long long n = 1LL << k;
+        root = buildComplete(nodes, n);
+
+        auto start = chrono::steady_clock::now();
+        long long fast = sol.countCompleteTree(root);
+        auto mid = chrono::steady_clock::now();
+        long long slow = 0;
+        inorder(root, slow);
+        auto end = chrono::steady_clock::now();
+
+        cout << "n = 2^" << k << ": binary search " << fast << " nodes in "
+             << chrono::duration<double, micro>(mid - start).count() << " us, O(N) "
+             << slow << " nodes in "
+             << chrono::duration<double, micro>(end - mid).count() << " us" << endl;
+    }
+
+    return 0;
+}
+
+/*
+Time Complexity: O(log N * log N) where N is the number of nodes in the Binary Tree.
+The loop runs once per level, that is log N times, and every iteration walks one leftmost path of at most log N nodes.
+The left height of the current subtree is carried over from the previous level instead of being recomputed.
+countNodes works on any tree and takes O(N).
+
+Space Complexity: O(1) for complete trees as the binary search runs in a loop without recursion.
+countNodes uses an explicit stack of at most O(N) nodes.
+*/
@@ -0,0 +1,287 @@
+/*
+Problem Statement: Given a static set of keys, either as a sorted array or as a Binary Search Tree, answer many lower_bound queries (the smallest key not less than x) as fast as possible.
+*/
+
+/*
+Algorithm / Intuition
+Searching a pointer based Binary Search Tree follows one child pointer per level. Every step needs the node loaded from memory before we even know where the next node is,
+so for trees larger than the cache every level costs a full memory latency and the CPU waits most of the time.
+For a tree that never changes we can drop the pointers altogether and store it as an implicit tree in Eytzinger (BFS) order, the layout of a binary heap:
+the root is at index 1 and the children of index k are at 2k and 2k + 1. The tree is complete, so its height is the minimum floor(log2 N) + 1.
+The array is filled from sorted keys by an inorder walk over the indices, exactly like building a complete tree from a sorted array.
+A pointer based Binary Search Tree is converted by taking its inorder traversal (for example with Morris Inorder Traversal), which is sorted, and filling the array from it.
+
+Lookup: start at k = 1 and move to k = 2k + (b[k] < x). The comparison result is used as a number, not as a branch, so the compiler emits no unpredictable jump.
+Once k runs past the end of the array, the answer is the last node where we went left. Going left appends a 0 bit to k and going right a 1 bit,
+so we drop the trailing 1 bits and the 0 bit before them: k >>= (number of trailing ones of k) + 1. If k becomes 0 we never went left and no key is >= x.
+
+Prefetching: the 16 descendants four levels below k are stored next to each other at 16k ... 16k + 15, which is 64 bytes, one cache line of int keys.
+So at every step we prefetch index 16k. This already covers the grandchildren and the two levels below them, and by the time we get there the line is in the cache.
+In the last four levels 16k lies past the end of the array. A prefetch never faults, but forming a pointer past the end is undefined, so the address is computed as an integer.
+
+Batched lookup: a single query still has to wait for its own memory accesses. With many queries we advance a group of them one level at a time, in lockstep.
+The loads of different queries are independent, so the CPU keeps many of them in flight at once and the memory latency is hidden.
+As the tree is complete, every query takes exactly H - 1 steps through the full levels and at most one more step in the last level, so the group needs no per query loop exit.
+
+Algorithm:
+Step 1: Allocate b[0 .. N] and fill b[1 .. N] with an iterative inorder walk over the indices, writing the next sorted key into every visited index.
+Step 2: lowerBound(x): k = 1, while k <= N: prefetch b[16k], k = 2k + (b[k] < x). Then k >>= ctz(~k) + 1 and return k (0 if there is no answer).
+Step 3: lowerBoundBatch: for every group of G queries, do H - 1 lockstep steps for all of them, one guarded step for the last level, and decode every k as in Step 2.
+*/
+
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+
+using namespace std;
+
+// TreeNode structure
+struct TreeNode {
+    int val;
+    TreeNode *left;
+    TreeNode *right;
+    TreeNode(int x) : val(x), left(nullptr), right(nullptr) {}
+};
+
+class EytzingerTree {
+public:
+    // Function to build the tree from sorted keys
+    EytzingerTree(const vector<int>& sorted) {
+        build(sorted);
+    }
+
+    // Function to build the tree from a Binary
+    // Search Tree using its inorder traversal
+    EytzingerTree(TreeNode* root) {
+        build(getInorder(root));
+    }
+
+    // Function to return the Eytzinger index of
+    // the smallest key >= x, or 0 if there is none
+    int lowerBound(int x) const {
+        const int* base = b.data();
+        int k = 1;
+        while (k <= n) {
+            // Prefetch the 16 descendants
+            // four levels below k
+            prefetch(base, 16 * (uintptr_t)k);
+            k = 2 * k + (base[k] < x);
+        }
+        // Drop the trailing right turns and
+        // the last left turn
+        k >>= __builtin_ffs(~k);
+        return k;
+    }
+
+    // Function to answer many lowerBound queries,
+    // advancing a group of them level by level
+    void lowerBoundBatch(const vector<int>& queries, vector<int>& result) const {
+        const int group = 16;
+        const int* base = b.data();
+        result.resize(queries.size());
+
+        for (size_t start = 0; start < queries.size(); start += group) {
+            int count = min((size_t)group, queries.size() - start);
+            const int* x = queries.data() + start;
+            int k[group];
+            for (int q = 0; q < count; q++) {
+                k[q] = 1;
+            }
+
+            // Every level above the last one is full,
+            // so all queries take these steps
+            for (int level = 1; level < height; level++) {
+                for (int q = 0; q < count; q++) {
+                    prefetch(base, 16 * (uintptr_t)k[q]);
+                    k[q] = 2 * k[q] + (base[k[q]] < x[q]);
+                }
+            }
+
+            // Last level, only present
+            // for some of the queries
+            for (int q = 0; q < count; q++) {
+                if (k[q] <= n) {
+                    k[q] = 2 * k[q] + (base[k[q]] < x[q]);
+                }
+                result[start + q] = k[q] >> __builtin_ffs(~k[q]);
+            }
+        }
+    }
+
+    // Function to return the key at an Eytzinger
+    // index returned by a lookup
+    int key(int k) const {
+        return b[k];
+    }
+
+    int size() const {
+        return n;
+    }
+
+private:
+    // Keys in Eytzinger order at indices
+    // 1 ... n, index 0 is unused
+    vector<int> b;
+    int n = 0;
+    int height = 0;
+
+    // Function to prefetch base[i], computing the address as
+    // an integer since i may lie past the end of the array
+    static void prefetch(const int* base, uintptr_t i) {
+        __builtin_prefetch((const void*)((uintptr_t)base + i * sizeof(int)));
+    }
+
+    void build(const vector<int>& sorted) {
+        n = sorted.size();
+        b.assign(n + 1, 0);
+        height = 0;
+        while ((1LL << height) <= n) {
+            height++;
+        }
+
+        // Iterative inorder walk over the implicit
+        // tree writing the next sorted key
+        vector<int> st;
+        int pos = 0;
+        int k = 1;
+        while (k <= n || !st.empty()) {
+            while (k <= n) {
+                st.push_back(k);
+                k = 2 * k;
+            }
+            k = st.back();
+            st.pop_back();
+            b[k] = sorted[pos++];
+            k = 2 * k + 1;
+        }
+    }
+
+    // Morris inorder traversal from
+    // Morris Inorder Traversal
+    static vector<int> getInorder(TreeNode* root) {
+        vector<int> inorder;
+        TreeNode* cur = root;
+        while (cur != NULL) {
+            if (cur->left == NULL) {
+                inorder.push_back(cur->val);
+                cur = cur->right;
+            } else {
+                TreeNode* prev = cur->left;
+                while (prev->right && prev->right != cur) {
+                    prev = prev->right;
+                }
+                if (prev->right == NULL) {
+                    prev->right = cur;
+                    cur = cur->left;
+                } else {
+                    prev->right = NULL;
+                    inorder.push_back(cur->val);
+                    cur = cur->right;
+                }
+            }
+        }
+        return inorder;
+    }
+};
+
+// Function to build a balanced pointer based
+// Binary Search Tree from sorted[lo .. hi]
+TreeNode* sortedToBST(const vector<int>& sorted, int lo, int hi) {
+    if (lo > hi) {
+        return NULL;
+    }
+    int mid = lo + (hi - lo) / 2;
+    TreeNode* node = new TreeNode(sorted[mid]);
+    node->left = sortedToBST(sorted, lo, mid - 1);
+    node->right = sortedToBST(sorted, mid + 1, hi);
+    return node;
+}
+
+// Function to find the smallest key >= x by
+// descending the pointer based tree
+TreeNode* pointerLowerBound(TreeNode* root, int x) {
+    TreeNode* answer = NULL;
+    while (root) {
+        if (root->val >= x) {
+            answer = root;
+            root = root->left;
+        } else {
+            root = root->right;
+        }
+    }
+    return answer;
+}
+
+int main() {
+    // Build from a Binary Search Tree
+    vector<int> sorted = {2, 5, 8, 13, 21, 34, 55, 89};
+    TreeNode* root = sortedToBST(sorted, 0, sorted.size() - 1);
+    EytzingerTree tree(root);
+
+    for (int x : {1, 13, 14, 89, 90}) {
+        int k = tree.lowerBound(x);
+        cout << "lower_bound(" << x << ") = ";
+        if (k == 0) {
+            cout << "none" << endl;
+        } else {
+            cout << tree.key(k) << endl;
+        }
+    }
+
+    // Benchmark against descending the pointer
+    // based tree on random queries
+    int n = 1 << 22;
+    int numQueries = 1 << 22;
+    mt19937 rng(11);
+    sorted.resize(n);
+    for (int i = 0; i < n; i++) {
+        sorted[i] = 2 * i;
+    }
+    vector<int> queries(numQueries);
+    for (int& x : queries) {
+        x = rng() % (2 * n);
+    }
+    root = sortedToBST(sorted, 0, n - 1);
+    EytzingerTree big(sorted);
+
+    long long checksum[3] = {0, 0, 0};
+    auto t0 = chrono::steady_clock::now();
+    for (int x : queries) {
+        TreeNode* node = pointerLowerBound(root, x);
+        checksum[0] += node ? node->val : -1;
+    }
+    auto t1 = chrono::steady_clock::now();
+    for (int x : queries) {
+        int k = big.lowerBound(x);
+        checksum[1] += k ? big.key(k) : -1;
+    }
+    auto t2 = chrono::steady_clock::now();
+    vector<int> result;
+    big.lowerBoundBatch(queries, result);
+    for (int k : result) {
+        checksum[2] += k ? big.key(k) : -1;
+    }
+    auto t3 = chrono::steady_clock::now();
+
+    cout << "n = " << n << ", " << numQueries << " queries" << endl;
+    cout << "Pointer descent: " << chrono::duration<double, milli>(t1 - t0).count() << " ms" << endl;
+    cout << "Eytzinger: " << chrono::duration<double, milli>(t2 - t1).count() << " ms" << endl;
+    cout << "Eytzinger batched: " << chrono::duration<double, milli>(t3 - t2).count() << " ms" << endl;
+    cout << "Results match: "
+         << (checksum[0] == checksum[1] && checksum[1] == checksum[2] ? "yes" : "no") << endl;
+
+    return 0;
+}
+
+/*
+Time Complexity: O(log N) per query where N is the number of keys, with exactly floor(log2 N) + 1 or floor(log2 N) comparisons as the tree is complete.
+Building takes O(N) from sorted keys, plus O(N) for the Morris inorder traversal when converting a pointer based tree.
+
+Space Complexity: O(N) for the array of N + 1 keys, with no child pointers at all, a third of the memory of a node with two pointers.
+The batched lookup keeps one index per query of the current group and the build keeps a stack of O(log N) indices.
+*/
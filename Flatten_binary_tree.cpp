@@ -453,4 +453,492 @@ The only space utilised is for a few auxiliary variables, such as pointers to cu
                                 
                             
                                                    
-                            
\ No newline at end of file
+                            
+
+//Flatten to Array Approach :
+/*
+Algorithm / Intuition
+All the approaches above turn the tree into a linked list threaded through the right pointers. Reading that list still costs one pointer dereference, and usually one cache miss, per node,
+and the tree itself is gone. When the consumer only needs the nodes in preorder, we can instead write them into a contiguous array that it scans sequentially.
+
+We traverse the tree with Morris Preorder Traversal, which needs no stack: before entering the left subtree of a node we link the rightmost node of that subtree (its predecessor) back to the node,
+and when we come back over that link we remove it again. Every temporary link is removed before the traversal ends, so the tree is left exactly as it was, although other threads reading the tree during the traversal would see the temporary links.
+The value of every node, and optionally a pointer to the node, is written to the caller's buffers at its preorder index.
+
+To rebuild the tree from the array we also need its shape. For every node we record whether it has a left child, in preorder, as this is known when the node is written.
+Whether a node has a real right child is only known one step later: Morris moves along the right pointer of a node once its left subtree is done,
+and that pointer is either a real child or a temporary link back to an ancestor, which we recognise at the next node when its predecessor links back to it.
+Nodes finish their left subtrees in inorder, so these right bits come out in inorder. The two bit arrays, left bits in preorder and right bits in inorder, form the shape bitmap.
+
+unflatten rebuilds the tree in the same order: it creates the nodes in preorder, and after the left subtree of a node is complete it reads the next right bit to know if the node has a right child.
+A stack holds the nodes whose left subtree is being built, so deep trees do not overflow the call stack.
+
+Algorithm:
+Step 1 (flattenToArray): Run Morris Preorder Traversal. When a node is reached for the first time, write its value, its handle and its left bit at the next preorder index.
+Only indices below the capacity of the buffers are written. The traversal always runs to the end, so every temporary link is removed, and it returns the number of nodes N,
+which tells the caller how large the buffers must be when N is above the capacity.
+Step 2: Every time we move along a right pointer remember it. At the next node, the move was a temporary link if the predecessor of that node links back to it, otherwise it was a real child: write the right bit.
+Moving to NULL at the end writes a 0. Remove every temporary link when we come back over it.
+Step 3: Return N, the buffers are complete only if N is at most the capacity.
+Step 3 (unflatten): Create node 0. While the current node has a left bit, push it, create the next node as its left child and move there.
+Then read the next right bit: if it is set create the next node as its right child and move there, otherwise pop the next node from the stack and read its right bit.
+*/
+
+
+#include <iostream>
+#include <vector>
+#include <cstdint>
+
+using namespace std;
+
+// TreeNode structure
+struct TreeNode {
+    int val;
+    TreeNode *left;
+    TreeNode *right;
+    TreeNode(int x) : val(x), left(nullptr), right(nullptr) {}
+};
+
+class Solution {
+public:
+    // Function to return the number of 64 bit words
+    // of each bit array of the shape of 'n' nodes
+    static size_t shapeWords(size_t n) {
+        return (n + 63) / 64;
+    }
+
+    // Function to write the preorder values of the tree into
+    // 'values' without changing the tree, every buffer holds
+    // 'capacity' entries (shapeWords(capacity) words for the
+    // bits). 'handles' receives the nodes, 'leftBits' and
+    // 'rightBits' the shape, each of them may be NULL.
+    // Returns the number of nodes N, if it is above
+    // 'capacity' only the first 'capacity' entries
+    // are written and the buffers must be enlarged
+    size_t flattenToArray(TreeNode* root, size_t capacity, int* values, TreeNode** handles = NULL,
+            uint64_t* leftBits = NULL, uint64_t* rightBits = NULL) {
+        size_t n = 0;
+        size_t r = 0;
+        // Set after moving along a right pointer
+        // until we know if it was a real child
+        bool pendingRight = false;
+
+        TreeNode* curr = root;
+        while (curr) {
+            // Find the predecessor of 'curr'
+            // inside its left subtree
+            TreeNode* pre = NULL;
+            if (curr->left) {
+                pre = curr->left;
+                while (pre->right && pre->right != curr) {
+                    pre = pre->right;
+                }
+            }
+            bool returning = (pre != NULL && pre->right == curr);
+
+            if (pendingRight) {
+                // We came over a temporary link
+                // exactly when we are returning
+                if (rightBits && r < capacity) {
+                    setBit(rightBits, r, !returning);
+                }
+                r++;
+                pendingRight = false;
+            }
+
+            if (returning) {
+                // The left subtree is done, remove
+                // the link and go to the right
+                pre->right = NULL;
+                curr = curr->right;
+                pendingRight = true;
+                continue;
+            }
+
+            // First visit of 'curr' in preorder, stop
+            // writing once the buffers are full but
+            // finish the traversal to remove the links
+            if (n < capacity) {
+                values[n] = curr->val;
+                if (handles) {
+                    handles[n] = curr;
+                }
+                if (leftBits) {
+                    setBit(leftBits, n, curr->left != NULL);
+                }
+            }
+            n++;
+
+            if (curr->left) {
+                // Link the predecessor back to 'curr'
+                // and traverse the left subtree
+                pre->right = curr;
+                curr = curr->left;
+            }
+            else {
+                curr = curr->right;
+                pendingRight = true;
+            }
+        }
+
+        // The last move was to NULL
+        if (pendingRight && rightBits && r < capacity) {
+            setBit(rightBits, r, false);
+        }
+        return n;
+    }
+
+    // Function to rebuild a tree from the preorder values and
+    // the shape written by flattenToArray, node i is stored
+    // in nodes[i] which must hold 'n' nodes
+    TreeNode* unflatten(const int* values, const uint64_t* leftBits,
+            const uint64_t* rightBits, size_t n, TreeNode* nodes) {
+        if (n == 0) {
+            return NULL;
+        }
+        size_t i = 0;
+        size_t r = 0;
+        nodes[0] = TreeNode(values[0]);
+        TreeNode* curr = &nodes[0];
+
+        // Nodes whose left subtree is being built
+        vector<TreeNode*> st;
+        while (true) {
+            // Go down along the left children
+            while (getBit(leftBits, i)) {
+                st.push_back(curr);
+                i++;
+                nodes[i] = TreeNode(values[i]);
+                curr->left = &nodes[i];
+                curr = curr->left;
+            }
+
+            // The left subtree of 'curr' is done, find
+            // the next node that has a right child
+            while (!getBit(rightBits, r++)) {
+                if (st.empty()) {
+                    return &nodes[0];
+                }
+                curr = st.back();
+                st.pop_back();
+            }
+            i++;
+            nodes[i] = TreeNode(values[i]);
+            curr->right = &nodes[i];
+            curr = curr->right;
+        }
+    }
+
+private:
+    static bool getBit(const uint64_t* bits, size_t i) {
+        return (bits[i / 64] >> (i % 64)) & 1;
+    }
+
+    static void setBit(uint64_t* bits, size_t i, bool value) {
+        if (value) {
+            bits[i / 64] |= 1ull << (i % 64);
+        }
+        else {
+            bits[i / 64] &= ~(1ull << (i % 64));
+        }
+    }
+};
+
+
+
+// Print the preorder traversal of the
+// Orignal Binary Tree
+void printPreorder(TreeNode* root){
+    if(!root){
+        return;
+    }
+    cout << root->val << " ";
+    printPreorder(root->left);
+    printPreorder(root->right);
+}
+
+// Print the Binary Tree in inorder
+void printInorder(TreeNode* root){
+    if(!root){
+        return;
+    }
+    printInorder(root->left);
+    cout << root->val << " ";
+    printInorder(root->right);
+}
+
+
+int main() {
+
+    TreeNode* root = new TreeNode(1);
+    root->left = new TreeNode(2);
+    root->right = new TreeNode(3);
+    root->left->left = new TreeNode(4);
+    root->left->right = new TreeNode(5);
+    root->left->right->right = new TreeNode(6);
+    root->right->right = new TreeNode(7);
+    root->right->left = new TreeNode(8);
+
+    Solution sol;
+
+    // Caller provided buffers, too small at
+    // first so the call reports the size needed
+    size_t capacity = 4;
+    vector<int> values(capacity);
+    vector<TreeNode*> handles(capacity);
+    vector<uint64_t> leftBits(Solution::shapeWords(capacity)), rightBits(Solution::shapeWords(capacity));
+
+    size_t n = sol.flattenToArray(root, capacity, values.data(), handles.data(), leftBits.data(), rightBits.data());
+    if (n > capacity) {
+        cout << "Buffers of " << capacity << " entries are too small, " << n << " needed" << endl;
+        capacity = n;
+        values.resize(capacity);
+        handles.resize(capacity);
+        leftBits.resize(Solution::shapeWords(capacity));
+        rightBits.resize(Solution::shapeWords(capacity));
+        n = sol.flattenToArray(root, capacity, values.data(), handles.data(), leftBits.data(), rightBits.data());
+    }
+
+    cout << "Flattened Array: ";
+    for (size_t i = 0; i < n; i++) {
+        cout << values[i] << " ";
+    }
+    cout << endl;
+
+    cout << "Binary Tree Preorder (unchanged): ";
+    printPreorder(root);
+    cout << endl;
+
+    // Downstream scans read the array sequentially
+    long long sum = 0;
+    for (size_t i = 0; i < n; i++) {
+        sum += values[i];
+    }
+    cout << "Sum of values: " << sum << endl;
+
+    vector<TreeNode> nodes(n, TreeNode(0));
+    TreeNode* copy = sol.unflatten(values.data(), leftBits.data(), rightBits.data(), n, nodes.data());
+
+    cout << "Rebuilt Tree Preorder: ";
+    printPreorder(copy);
+    cout << endl;
+    cout << "Rebuilt Tree Inorder: ";
+    printInorder(copy);
+    cout << endl;
+
+    return 0;
+}
+
+/*
+Time Complexity: O(N) where N is the number of nodes in the Binary Tree.
+As in Morris Traversal every edge is walked at most twice to find the predecessors, once to create each temporary link and once to remove it. unflatten creates every node once.
+
+Space Complexity: O(1) extra space for flattenToArray besides the caller's buffers of N values, N handles and 2N bits of shape.
+A call with buffers that are too small still takes O(N) time and leaves the tree unchanged, it only reports the size needed.
+unflatten uses a stack of at most H nodes where H is the height of the Binary Tree.
+*/
+
+//Reversible Flatten Approach :
+/*
+Algorithm / Intuition
+Every flatten above destroys the shape of the tree, so a caller that only needs the linked list for a while has to deep-copy the tree first.
+To undo the flatten we do not need a copy. The list keeps every node and keeps them in preorder, so the only information lost is the shape:
+for every node, whether it had a left child and whether it had a right child. That is 2 bits per node, which we record while flattening.
+
+The flatten is the stack based one from the Better Approach. When a node is popped its own left and right pointers have not been changed yet, as a node is only relinked when it is popped itself,
+so we write its two bits at its preorder index before relinking it.
+
+Restoring walks the list in preorder and relinks every node to its parent. In preorder the node after a node with a left child is that left child.
+Otherwise it is the right child of the deepest node seen so far that has a right child not yet linked. These nodes are kept on a stack, and the deepest one is on top.
+The list pointer of a node is read before the node is relinked, so the walk never loses its place.
+The only memory used is the 2N bit log, allocated once and reused across calls, and a stack of at most H nodes in both directions.
+
+Algorithm:
+Step 1 (flatten): Run the stack based flatten. When a node is popped, write bit 2i = (left != NULL) and bit 2i + 1 = (right != NULL) for its preorder index i, then relink it as before.
+Step 2 (restore): Walk the list keeping the previous node. Read the next list node, then clear the links of the current node.
+If the previous node had a left child, the current node is its left child. Otherwise pop the top of the stack and make the current node its right child.
+Push the current node if it had a right child.
+*/
+
+
+#include <iostream>
+#include <vector>
+#include <cstdint>
+
+using namespace std;
+
+// TreeNode structure
+struct TreeNode {
+    int val;
+    TreeNode *left;
+    TreeNode *right;
+    TreeNode(int x) : val(x), left(nullptr), right(nullptr) {}
+};
+
+// Shape of a flattened tree, bit 2i tells if the
+// node at preorder index i had a left child and
+// bit 2i + 1 if it had a right child
+struct ShapeLog {
+    vector<uint64_t> bits;
+    size_t size = 0;
+};
+
+class Solution {
+public:
+    // Function to flatten a binary tree to a right
+    // next Linked List structure, recording its
+    // shape in 'log' so that it can be restored
+    void flatten(TreeNode* root, ShapeLog& log) {
+        log.size = 0;
+        log.bits.clear();
+        if(root == NULL){
+            return;
+        }
+        st.clear();
+        st.push_back(root);
+
+        while (!st.empty()) {
+            TreeNode* cur = st.back();
+            st.pop_back();
+
+            // Record the links before
+            // they are changed
+            size_t i = log.size++;
+            if (2 * i / 64 == log.bits.size()) {
+                log.bits.push_back(0);
+            }
+            uint64_t shape = (cur->left ? 1 : 0) | (cur->right ? 2 : 0);
+            log.bits[2 * i / 64] |= shape << (2 * i % 64);
+
+            if (cur->right != NULL) {
+                st.push_back(cur->right);
+            }
+            if (cur->left != NULL) {
+                st.push_back(cur->left);
+            }
+            if (!st.empty()) {
+                cur->right = st.back();
+            }
+            cur->left = NULL;
+        }
+    }
+
+    // Function to restore the tree flattened into the
+    // list starting at 'head' from its shape log
+    void restore(TreeNode* head, const ShapeLog& log) {
+        st.clear();
+        TreeNode* prev = NULL;
+        bool prevHasLeft = false;
+        TreeNode* cur = head;
+
+        for (size_t i = 0; i < log.size && cur != NULL; i++) {
+            // Read the list pointer before
+            // the node is relinked
+            TreeNode* next = cur->right;
+            cur->left = NULL;
+            cur->right = NULL;
+
+            if (prev != NULL) {
+                if (prevHasLeft) {
+                    prev->left = cur;
+                }
+                else {
+                    // Right child of the deepest node
+                    // still missing its right child
+                    st.back()->right = cur;
+                    st.pop_back();
+                }
+            }
+
+            uint64_t shape = (log.bits[2 * i / 64] >> (2 * i % 64)) & 3;
+            if (shape & 2) {
+                st.push_back(cur);
+            }
+            prev = cur;
+            prevHasLeft = (shape & 1);
+            cur = next;
+        }
+    }
+
+private:
+    // Stack reused by both directions,
+    // holding at most H nodes
+    vector<TreeNode*> st;
+};
+
+
+
+// Print the preorder traversal of the
+// Orignal Binary Tree
+void printPreorder(TreeNode* root){
+    if(!root){
+        return;
+    }
+    cout << root->val << " ";
+    printPreorder(root->left);
+    printPreorder(root->right);
+}
+
+// Print the Binary Tree in inorder
+void printInorder(TreeNode* root){
+    if(!root){
+        return;
+    }
+    printInorder(root->left);
+    cout << root->val << " ";
+    printInorder(root->right);
+}
+
+// Print the Binary Tree along the
+// Right Pointers after Flattening
+void printFlattenTree(TreeNode* root){
+    if(!root){
+        return;
+    }
+    cout << root->val << " ";
+    printFlattenTree(root->right);
+}
+
+
+int main() {
+
+    TreeNode* root = new TreeNode(1);
+    root->left = new TreeNode(2);
+    root->right = new TreeNode(3);
+    root->left->left = new TreeNode(4);
+    root->left->right = new TreeNode(5);
+    root->left->right->right = new TreeNode(6);
+    root->right->right = new TreeNode(7);
+    root->right->left = new TreeNode(8);
+
+    Solution sol;
+    ShapeLog log;
+
+    cout << "Binary Tree Inorder: ";
+    printInorder(root);
+    cout << endl;
+
+    sol.flatten(root, log);
+
+    cout << "Binary Tree After Flatten: ";
+    printFlattenTree(root);
+    cout << endl;
+
+    sol.restore(root, log);
+
+    cout << "Binary Tree After Restore (Preorder): ";
+    printPreorder(root);
+    cout << endl;
+    cout << "Binary Tree After Restore (Inorder): ";
+    printInorder(root);
+    cout << endl;
+
+    return 0;
+}
+
+/*
+Time Complexity: O(N) where N is the number of nodes in the Binary Tree, for both flatten and restore, as every node is pushed, popped and relinked once.
+
+Space Complexity: O(N) bits for the shape log, 2 bits per node, instead of a deep copy of N nodes.
+Both directions use a stack of O(H) nodes where H is the height of the Binary Tree, and the log and the stack keep their memory when they are reused.
+*/
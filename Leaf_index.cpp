@@ -0,0 +1,247 @@
+/*
+Problem Statement: Given a Binary Tree that changes over time, keep its leaves from left to right in one contiguous array,
+so that algorithms that only need the leaves can iterate over them without traversing the internal nodes.
+*/
+
+/*
+Algorithm / Intuition
+Collecting the leaves, as addLeaves does in the Boundary Traversal, visits every node of the tree, although usually only about half of them are leaves.
+If the leaves are kept in an array in left to right order, leaf-only work becomes a sequential scan of that array.
+The array has to follow the changes of the tree, so every node keeps its parent and its position in the array (-1 for an internal node), and all changes go through the index:
+
+Adding a child to a leaf: the leaf becomes an internal node and its new child is the only leaf of its subtree, so the child simply takes the slot of its parent in O(1).
+This is how trees usually grow, one level at a time.
+Adding a left child to a node that already has a right subtree: the new leaf comes just before the leftmost leaf of the right subtree, found by walking down in O(H).
+Adding a right child next to an existing left subtree is the mirror image: the new leaf comes just after the rightmost leaf of the left subtree.
+Removing a leaf: if its parent becomes a leaf, the parent takes over the slot in O(1), otherwise the slot is removed from the array.
+Inserting or removing a slot in the middle moves the following leaves by one position, which is a single memmove of the array, and their stored positions are renumbered.
+
+Algorithm:
+Step 1: attach(root): traverse the tree in preorder with an explicit stack, setting the parent of every node and appending every leaf to the array with its position.
+Step 2: addLeft(node, val) / addRight(node, val): if the node already has that child, reject the call, as replacing it would orphan the old subtree and its leaves in the array.
+If the node is a leaf the new child takes its slot. Otherwise find the neighbouring leaf of the other subtree and insert the new child next to it.
+Step 3: removeLeaf(leaf): unlink it from its parent. If the parent became a leaf it takes the slot, otherwise erase the slot. Renumber the positions after any insert or erase.
+Step 4: leaves() returns the array.
+*/
+
+
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+// Node structure for the binary tree with its
+// parent and its position in the leaf array
+struct Node {
+    int data;
+    Node* left;
+    Node* right;
+    Node* parent;
+    int leafPos;
+    // Constructor to initialize
+    // the node with a value
+    Node(int val) : data(val), left(nullptr), right(nullptr), parent(nullptr), leafPos(-1) {}
+};
+
+class LeafIndex {
+public:
+    // Function to index an existing tree, setting the
+    // parent pointers and collecting its leaves
+    void attach(Node* root) {
+        leafArray.clear();
+        if (root == NULL) {
+            return;
+        }
+        root->parent = NULL;
+        vector<Node*> st;
+        st.push_back(root);
+        while (!st.empty()) {
+            Node* node = st.back();
+            st.pop_back();
+            node->leafPos = -1;
+            if (isLeaf(node)) {
+                node->leafPos = leafArray.size();
+                leafArray.push_back(node);
+            }
+            if (node->right) {
+                node->right->parent = node;
+                st.push_back(node->right);
+            }
+            if (node->left) {
+                node->left->parent = node;
+                st.push_back(node->left);
+            }
+        }
+    }
+
+    // Function to add a new left child with value 'val'
+    // to 'node', returns NULL if it already has one
+    Node* addLeft(Node* node, int val) {
+        if (node->left) {
+            return NULL;
+        }
+        Node* child = new Node(val);
+        child->parent = node;
+        if (isLeaf(node)) {
+            replaceSlot(node, child);
+        }
+        else {
+            // Just before the leftmost
+            // leaf of the right subtree
+            insertAt(leftmostLeaf(node->right)->leafPos, child);
+        }
+        node->left = child;
+        return child;
+    }
+
+    // Function to add a new right child with value 'val'
+    // to 'node', returns NULL if it already has one
+    Node* addRight(Node* node, int val) {
+        if (node->right) {
+            return NULL;
+        }
+        Node* child = new Node(val);
+        child->parent = node;
+        if (isLeaf(node)) {
+            replaceSlot(node, child);
+        }
+        else {
+            // Just after the rightmost
+            // leaf of the left subtree
+            insertAt(rightmostLeaf(node->left)->leafPos + 1, child);
+        }
+        node->right = child;
+        return child;
+    }
+
+    // Function to remove and delete a leaf,
+    // which must not be the root
+    void removeLeaf(Node* leaf) {
+        Node* par = leaf->parent;
+        if (par->left == leaf) {
+            par->left = NULL;
+        }
+        else {
+            par->right = NULL;
+        }
+        if (isLeaf(par)) {
+            replaceSlot(leaf, par);
+        }
+        else {
+            eraseAt(leaf->leafPos);
+        }
+        delete leaf;
+    }
+
+    // Function to return the leaves
+    // from left to right
+    const vector<Node*>& leaves() const {
+        return leafArray;
+    }
+
+private:
+    // Leaves from left to right
+    vector<Node*> leafArray;
+
+    static bool isLeaf(Node* node) {
+        return !node->left && !node->right;
+    }
+
+    static Node* leftmostLeaf(Node* node) {
+        while (!isLeaf(node)) {
+            node = node->left ? node->left : node->right;
+        }
+        return node;
+    }
+
+    static Node* rightmostLeaf(Node* node) {
+        while (!isLeaf(node)) {
+            node = node->right ? node->right : node->left;
+        }
+        return node;
+    }
+
+    // Function to give the slot of 'from' to 'to'
+    void replaceSlot(Node* from, Node* to) {
+        to->leafPos = from->leafPos;
+        leafArray[to->leafPos] = to;
+        from->leafPos = -1;
+    }
+
+    void insertAt(int pos, Node* node) {
+        leafArray.insert(leafArray.begin() + pos, node);
+        renumber(pos);
+    }
+
+    void eraseAt(int pos) {
+        leafArray.erase(leafArray.begin() + pos);
+        renumber(pos);
+    }
+
+    // Function to update the stored positions
+    // of the leaves from 'pos' onwards
+    void renumber(int pos) {
+        for (int i = pos; i < (int)leafArray.size(); i++) {
+            leafArray[i]->leafPos = i;
+        }
+    }
+};
+
+// Function to print the
+// leaves of the tree
+void printLeaves(const LeafIndex& index) {
+    for (Node* leaf : index.leaves()) {
+        cout << leaf->data << " ";
+    }
+    cout << endl;
+}
+
+int main() {
+    // Creating a sample binary tree
+    Node* root = new Node(1);
+    root->left = new Node(2);
+    root->right = new Node(3);
+    root->left->left = new Node(4);
+    root->left->right = new Node(5);
+    root->right->left = new Node(6);
+    root->right->right = new Node(7);
+
+    LeafIndex index;
+    index.attach(root);
+
+    cout << "Leaves: ";
+    printLeaves(index);
+
+    // Grow a leaf, then add a leaf between
+    // two existing subtrees
+    Node* eight = index.addLeft(root->left->left, 8);
+    index.addRight(eight, 9);
+    index.addLeft(eight, 10);
+    cout << "Leaves after adding 8, 9, 10: ";
+    printLeaves(index);
+
+    // 8 already has a left child
+    cout << "Second left child of 8 rejected: " << (index.addLeft(eight, 11) == NULL) << endl;
+
+    index.removeLeaf(root->left->right);
+    index.removeLeaf(root->right->left);
+    cout << "Leaves after removing 5 and 6: ";
+    printLeaves(index);
+
+    // Leaf-only analytics scan the array
+    long long sum = 0;
+    for (Node* leaf : index.leaves()) {
+        sum += leaf->data;
+    }
+    cout << "Sum of the leaves: " << sum << endl;
+
+    return 0;
+}
+
+/*
+Time Complexity: O(N) for attach where N is the number of nodes. Iterating over the leaves takes O(L) where L is the number of leaves, without touching any internal node.
+Adding a child to a leaf and removing a leaf whose parent becomes a leaf take O(1).
+Adding a child next to an existing subtree takes O(H) to find the neighbouring leaf plus O(L) to shift and renumber the following leaves, and so does removing a leaf from a node with two children.
+
+Space Complexity: O(N) for the parent and the position stored in every node and the array of L leaves. attach uses a stack of O(H) nodes where H is the height of the tree.
+*/
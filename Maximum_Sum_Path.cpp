@@ -124,3 +124,236 @@ Space Complexity: O(1) as no additional space or data structures is created that
 O(H) Recursive Stack Auxiliary Space : The recursion stack space is determined by the maximum depth of the recursion, which is the height of the binary tree denoted as H. 
 In the balanced case it is log2N and in the worst case its N.
 */      
+
+//Wide Accumulator Approach :
+/*
+Algorithm / Intuition
+The solution above adds the values in int and starts from INT_MIN, so on large values the sums silently wrap around and the answer is wrong without any warning.
+It also only returns the sum, while the caller usually needs to know which path it is.
+
+Both are fixed without changing the algorithm. The sums are computed in an accumulator type chosen by the caller through a template parameter:
+int64_t is enough while N times the largest value fits in 63 bits, __int128 can never overflow for a tree of 64 bit values, and Checked<int64_t> adds in 64 bits but records any overflow, so a wrong result is never returned unnoticed.
+Instead of starting from INT_MIN, the first path found becomes the answer, which works for any accumulator type.
+
+With Checked the pass stops at the first overflow and returns a sum flagged as overflowed, with no endpoints as the best path is not known.
+Any sum of the algorithm is at most the sum through some turning point, so checking those sums is enough.
+
+Together with the best downward sum of every subtree we return the node where that downward path ends. At the turning point the best path runs from the end of the left downward path to the end of the right one,
+or starts at the turning point itself when that side is left out because its sum is not positive. So the endpoints of the best path are known as soon as the best sum is updated, in the same pass.
+
+The traversal is an iterative postorder with an explicit stack, so deep trees do not overflow the call stack. The results of the children are kept on a second stack: when a node is finished
+the results of its right and left child are on top of it, as they were the last subtrees finished.
+
+Algorithm:
+Step 1: Push (root, first visit). On the first visit of a node push it back as visited, then its right and left child.
+Step 2: On the second visit pop the results (sum, end) of its right and left child, an empty side counts as (0, none). Replace a result with (0, none) when its sum is not positive.
+Step 3: through = left.sum + right.sum + value. If it overflowed return it flagged, with both endpoints NULL. If it is the first path or larger than the best one, the best path is through with endpoints (left.end or the node) and (right.end or the node).
+Step 4: Push (the larger side sum + value, its end or the node) as the result of the node.
+*/
+
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <utility>
+#include <cstdint>
+#include <climits>
+
+using namespace std;
+
+// Node structure for the binary
+// tree with a 64 bit value
+struct Node {
+    long long data;
+    Node* left;
+    Node* right;
+    // Constructor to initialize
+    // the node with a value
+    Node(long long val) : data(val), left(nullptr), right(nullptr) {}
+};
+
+// Integer that records whether
+// any addition overflowed
+template <typename T>
+struct Checked {
+    T value;
+    bool overflow;
+    Checked(T v = 0) : value(v), overflow(false) {}
+
+    Checked operator+(const Checked& other) const {
+        Checked sum;
+        sum.overflow = overflow || other.overflow
+            || __builtin_add_overflow(value, other.value, &sum.value);
+        return sum;
+    }
+    bool operator<(const Checked& other) const {
+        return value < other.value;
+    }
+};
+
+// Function to check if a sum overflowed,
+// only Checked accumulators can tell
+template <typename T>
+bool hasOverflowed(const T&) {
+    return false;
+}
+
+template <typename T>
+bool hasOverflowed(const Checked<T>& x) {
+    return x.overflow;
+}
+
+// Maximum path sum and the two endpoints of the
+// path, the endpoints are NULL for an empty tree
+// or when hasOverflowed(sum), and valid otherwise
+template <typename Acc>
+struct MaxPath {
+    Acc sum;
+    Node* from;
+    Node* to;
+};
+
+class Solution {
+public:
+    // Function to find the maximum path sum and its endpoints,
+    // adding the values in the accumulator type 'Acc'
+    template <typename Acc>
+    MaxPath<Acc> maxPathSum(Node* root) {
+        MaxPath<Acc> best = {Acc(0), NULL, NULL};
+        if (root == NULL) {
+            return best;
+        }
+
+        // Best downward sum of a subtree
+        // and the node where it ends
+        struct Down {
+            Acc sum;
+            Node* end;
+        };
+        vector<Down> results;
+
+        vector<pair<Node*, bool>> st;
+        st.push_back({root, false});
+        while (!st.empty()) {
+            Node* node = st.back().first;
+            bool visited = st.back().second;
+            st.pop_back();
+
+            if (!visited) {
+                st.push_back({node, true});
+                if (node->right) {
+                    st.push_back({node->right, false});
+                }
+                if (node->left) {
+                    st.push_back({node->left, false});
+                }
+                continue;
+            }
+
+            // The right subtree finished last,
+            // so its result is on top
+            Down empty = {Acc(0), NULL};
+            Down rightMaxPath = empty, leftMaxPath = empty;
+            if (node->right) {
+                rightMaxPath = results.back();
+                results.pop_back();
+            }
+            if (node->left) {
+                leftMaxPath = results.back();
+                results.pop_back();
+            }
+
+            // Leave out sides that do not
+            // increase the sum
+            if (!(Acc(0) < leftMaxPath.sum)) {
+                leftMaxPath = empty;
+            }
+            if (!(Acc(0) < rightMaxPath.sum)) {
+                rightMaxPath = empty;
+            }
+
+            // Path with the current node
+            // as the turning point
+            Acc value = Acc(node->data);
+            Acc through = leftMaxPath.sum + rightMaxPath.sum + value;
+            if (hasOverflowed(through)) {
+                // The result can no longer be trusted,
+                // return the flagged sum at once
+                return {through, NULL, NULL};
+            }
+            if (best.from == NULL || best.sum < through) {
+                best.sum = through;
+                best.from = leftMaxPath.end ? leftMaxPath.end : node;
+                best.to = rightMaxPath.end ? rightMaxPath.end : node;
+            }
+
+            // Continue the better side upwards
+            Down up = rightMaxPath.sum < leftMaxPath.sum ? leftMaxPath : rightMaxPath;
+            up.sum = up.sum + value;
+            if (up.end == NULL) {
+                up.end = node;
+            }
+            results.push_back(up);
+        }
+        return best;
+    }
+};
+
+// Function to convert a 128
+// bit integer to a string
+string toString(__int128 x) {
+    if (x == 0) {
+        return "0";
+    }
+    bool negative = x < 0;
+    string s;
+    while (x != 0) {
+        int digit = (int)(x % 10);
+        s += char('0' + (negative ? -digit : digit));
+        x /= 10;
+    }
+    if (negative) {
+        s += '-';
+    }
+    return string(s.rbegin(), s.rend());
+}
+
+
+int main() {
+    // Creating a sample binary tree
+    Node* root = new Node(1);
+    root->left = new Node(2);
+    root->right = new Node(3);
+    root->left->left = new Node(4);
+    root->left->right = new Node(5);
+    root->left->right->right = new Node(6);
+    root->left->right->right->right = new Node(7);
+
+    Solution solution;
+
+    MaxPath<int64_t> path = solution.maxPathSum<int64_t>(root);
+    cout << "Maximum Path Sum: " << path.sum
+         << " from " << path.from->data << " to " << path.to->data << endl;
+
+    // Values whose sums overflow 64 bits
+    root->left->left->data = LLONG_MAX / 2;
+    root->left->right->right->right->data = LLONG_MAX / 2;
+
+    MaxPath<Checked<int64_t>> checked = solution.maxPathSum<Checked<int64_t>>(root);
+    cout << "64 bit overflow detected: " << hasOverflowed(checked.sum)
+         << ", endpoints cleared: " << (checked.from == NULL && checked.to == NULL) << endl;
+
+    MaxPath<__int128> wide = solution.maxPathSum<__int128>(root);
+    cout << "Maximum Path Sum in 128 bits: " << toString(wide.sum)
+         << " from " << wide.from->data << " to " << wide.to->data << endl;
+
+    return 0;
+}
+
+/*
+Time Complexity: O(N) where N is the number of nodes in the Binary Tree, as every node is pushed twice and its result is computed once, with the endpoints tracked in the same pass.
+Every addition and comparison takes O(1) for all three accumulator types.
+
+Space Complexity: O(H) for the traversal stack and the stack of results where H is the height of the Binary Tree, O(N) in the worst case of a skewed tree.
+Both stacks live on the heap, so deep trees do not overflow the call stack.
+*/
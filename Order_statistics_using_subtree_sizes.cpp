@@ -0,0 +1,288 @@
+/*
+Problem Statement: Given a Binary Tree, answer order statistic queries on its inorder sequence:
+select(k) returns the node at position k of the inorder traversal, and rank(node) returns the position of a given node in the inorder traversal.
+The tree can change between queries through insertions, deletions and flattening.
+*/
+
+/*
+Algorithm / Intuition
+Counting the nodes of a subtree takes O(N), see Count total Nodes in a Binary Tree, so answering select or rank by counting subtrees on every query is O(N) per query.
+Instead we augment every node with the size of its subtree: size(node) = 1 + size(left) + size(right), with size(NULL) = 0.
+The size of the left subtree tells us exactly how many nodes come before the current node inside its subtree in inorder, which is all we need to navigate.
+
+select(k): starting at the root, let L be the size of the left subtree. If k < L the answer is in the left subtree. If k == L the answer is the current node.
+Otherwise it is in the right subtree at position k - L - 1. Every step moves one level down, so this is O(H).
+
+rank(node): the nodes before a node in inorder are its left subtree, plus, for every ancestor reached from its right child, that ancestor and its left subtree.
+With a parent pointer in every node we walk up from the node and add these sizes, which is O(H).
+
+Keeping the sizes correct: a mutation only changes the sizes of the nodes whose subtree gained or lost nodes, and those are exactly the ancestors of the changed position.
+insertAt(k, value) makes the new node the k-th node in inorder: it becomes the left child of the current k-th node if that has no left child,
+otherwise the right child of its inorder predecessor (the rightmost node of its left subtree). At the end of the sequence it becomes the right child of the last node.
+Then we add 1 to the size of every ancestor. erase(node) splices a node with at most one child out and subtracts 1 from every ancestor.
+A node with two children is replaced by its right subtree after hanging its left subtree under the leftmost node of the right subtree, which keeps the inorder sequence intact.
+flatten rewires every node, so the sizes and parents are rebuilt in one pass over the resulting list: the i-th of N list nodes has size N - i.
+changeTree from Check for Children Sum Property only changes values and never the shape, so it keeps every size valid without any update.
+
+Algorithm:
+Step 1: Store data, size, left, right and parent in every node. A new node has size 1.
+Step 2: select(k): while the node is not NULL compare k with the left size L: go left, return the node, or go right with k - L - 1.
+Step 3: rank(node): start with the left size of the node, then walk up, adding 1 + left size of the parent whenever we come up from a right child.
+Step 4: insertAt / erase: relink the node as described above and update the sizes of all ancestors of the changed position.
+Step 5: flatten: flatten the tree to a right linked list in preorder, then walk it once to set every parent and size.
+*/
+
+
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+// Node structure for the binary tree,
+// augmented with the size of its subtree
+// and a pointer to its parent
+struct Node {
+    int data;
+    int size;
+    Node* left;
+    Node* right;
+    Node* parent;
+    // Constructor to initialize
+    // the node with a value
+    Node(int val) : data(val), size(1), left(nullptr), right(nullptr), parent(nullptr) {}
+};
+
+class OrderStatisticTree {
+public:
+    Node* root = nullptr;
+
+    // Function to return the size of a subtree,
+    // an empty subtree has size 0
+    static int size(Node* node) {
+        return node ? node->size : 0;
+    }
+
+    // Function to return the node at position
+    // k (0 based) of the inorder traversal,
+    // or NULL if k is out of range
+    Node* select(int k) {
+        Node* node = root;
+        while (node) {
+            int leftSize = size(node->left);
+            if (k < leftSize) {
+                node = node->left;
+            }
+            else if (k == leftSize) {
+                return node;
+            }
+            else {
+                k -= leftSize + 1;
+                node = node->right;
+            }
+        }
+        return nullptr;
+    }
+
+    // Function to return the position (0 based)
+    // of a node in the inorder traversal
+    int rank(Node* node) {
+        int r = size(node->left);
+        while (node->parent) {
+            // Coming up from a right child, the parent
+            // and its left subtree come before us
+            if (node == node->parent->right) {
+                r += 1 + size(node->parent->left);
+            }
+            node = node->parent;
+        }
+        return r;
+    }
+
+    // Function to insert 'val' so that it becomes the
+    // node at position k of the inorder traversal
+    Node* insertAt(int k, int val) {
+        Node* node = new Node(val);
+        if (root == nullptr) {
+            root = node;
+            return node;
+        }
+
+        int n = size(root);
+        if (k >= n) {
+            // Append after the last node in inorder
+            Node* last = root;
+            while (last->right) {
+                last = last->right;
+            }
+            attach(last, node, false);
+        }
+        else {
+            // Insert before the current k-th node
+            Node* next = select(k);
+            if (next->left == nullptr) {
+                attach(next, node, true);
+            }
+            else {
+                Node* pred = next->left;
+                while (pred->right) {
+                    pred = pred->right;
+                }
+                attach(pred, node, false);
+            }
+        }
+        return node;
+    }
+
+    // Function to remove a node while keeping
+    // the inorder order of the other nodes
+    void erase(Node* node) {
+        if (node->left && node->right) {
+            // Hang the left subtree under the leftmost
+            // node of the right subtree, which keeps the
+            // inorder order, then the node has one child
+            Node* succ = node->right;
+            while (succ->left) {
+                succ = succ->left;
+            }
+            Node* left = node->left;
+            node->left = nullptr;
+            succ->left = left;
+            left->parent = succ;
+            addToAncestors(succ, size(left), node);
+        }
+
+        // Splice out the node with at most one child
+        Node* child = node->left ? node->left : node->right;
+        Node* parent = node->parent;
+        if (child) {
+            child->parent = parent;
+        }
+        if (parent == nullptr) {
+            root = child;
+        }
+        else if (parent->left == node) {
+            parent->left = child;
+        }
+        else {
+            parent->right = child;
+        }
+        addToAncestors(parent, -1, nullptr);
+        delete node;
+    }
+
+    // Function to flatten the tree to a right next
+    // linked list in preorder, keeping the sizes
+    // and parents of the list correct
+    void flatten() {
+        // Morris style flattening from
+        // Flatten Binary Tree to Linked List
+        Node* curr = root;
+        while (curr) {
+            if (curr->left) {
+                Node* pre = curr->left;
+                while (pre->right) {
+                    pre = pre->right;
+                }
+                pre->right = curr->right;
+                curr->right = curr->left;
+                curr->left = nullptr;
+            }
+            curr = curr->right;
+        }
+
+        // The i-th of the n list nodes heads
+        // a list of n - i nodes
+        int n = size(root);
+        Node* prev = nullptr;
+        for (Node* node = root; node; node = node->right) {
+            node->parent = prev;
+            node->size = n--;
+            prev = node;
+        }
+    }
+
+private:
+    // Function to link 'node' as a child of
+    // 'parent' and grow the ancestor sizes
+    void attach(Node* parent, Node* node, bool asLeft) {
+        if (asLeft) {
+            parent->left = node;
+        }
+        else {
+            parent->right = node;
+        }
+        node->parent = parent;
+        addToAncestors(parent, 1, nullptr);
+    }
+
+    // Function to add 'delta' to the size of
+    // 'node' and its ancestors up to 'stop'
+    void addToAncestors(Node* node, int delta, Node* stop) {
+        while (node != stop) {
+            node->size += delta;
+            node = node->parent;
+        }
+    }
+};
+
+// Function to print the inorder
+// traversal with the subtree sizes
+void printInorder(Node* root) {
+    if (!root) {
+        return;
+    }
+    printInorder(root->left);
+    cout << root->data << "(" << root->size << ") ";
+    printInorder(root->right);
+}
+
+int main() {
+    OrderStatisticTree tree;
+
+    // Build the inorder sequence 10 20 30 40 50 60
+    // by inserting at its inorder positions
+    tree.insertAt(0, 40);
+    tree.insertAt(0, 20);
+    tree.insertAt(2, 60);
+    tree.insertAt(1, 30);
+    tree.insertAt(0, 10);
+    tree.insertAt(4, 50);
+
+    cout << "Inorder with subtree sizes: ";
+    printInorder(tree.root);
+    cout << endl;
+
+    // Page through the inorder sequence
+    // two nodes at a time
+    for (int k = 0; k < OrderStatisticTree::size(tree.root); k += 2) {
+        Node* node = tree.select(k);
+        cout << "select(" << k << ") = " << node->data
+             << ", rank = " << tree.rank(node) << endl;
+    }
+
+    // Erase the node at position 2 and
+    // the node holding the root value
+    tree.erase(tree.select(2));
+    tree.erase(tree.root);
+    cout << "After erasing: ";
+    printInorder(tree.root);
+    cout << endl;
+
+    // Flatten to the preorder list
+    tree.flatten();
+    cout << "After flatten: ";
+    for (Node* node = tree.root; node; node = node->right) {
+        cout << node->data << "(" << node->size << ") ";
+    }
+    cout << endl;
+
+    return 0;
+}
+
+/*
+Time Complexity: O(H) per select, rank, insertAt and erase where H is the height of the Binary Tree.
+Each of them walks one path between the root and a node, and a mutation updates only the sizes of the ancestors of the changed position.
+flatten takes O(N) as it rewires every node, and rebuilding the sizes is a single extra pass over the list.
+
+Space Complexity: O(N) for the size and parent stored in every node. The queries and updates themselves use O(1) extra space as they run in loops without recursion.
+*/
@@ -138,4 +138,417 @@ This is because the stack can potentially hold all nodes in the tree when dealin
 O(H): In the average case or for a balanced tree, the maximum number of nodes that could be in the stack at any given time would be roughly the height of the tree hence O(log2N).
 */
                             
-                        
\ No newline at end of file
+                        
+
+//Parent Index Approach :
+/*
+Algorithm / Intuition
+getPath searches the whole tree with a DFS for every query, so answering Q queries costs O(Q * N) even though every path is only as long as the depth of its node.
+If every node knows its parent, the path to a node is found by walking up from the node to the root and reversing, which is O(depth).
+Two things are needed for that: the parent of every node, and a way to locate the node holding the value B without searching.
+
+Both are built once with one traversal. Every node gets an index in preorder, and we store its value in vals[i] and the index of its parent in parent[i], a plain uint32_t array
+next to the tree, so the TreeNode structure does not change. For trees that are already stored by index this array is all that is needed, and a tree whose nodes embed a parent pointer is walked the same way.
+The values are unique, so a hash map from value to index locates the node in O(1).
+If a value does occur more than once, the map keeps its first occurrence in preorder, which is the node the DFS of getPath finds, so both return the same path.
+The index describes the tree at the time it was built, so it has to be rebuilt after the tree changes.
+
+Algorithm:
+Step 1: Traverse the tree in preorder with an explicit stack holding (node, parent index). Give every node the next index i, store vals[i], parent[i] and the position of its value in the map
+unless the value is already there.
+Step 2: solve(B): look B up in the map. If it is absent return an empty path.
+Step 3: Walk from its index to the root through parent[], appending every value, then reverse the path so that it starts at the root.
+*/
+
+
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+using namespace std;
+
+// TreeNode structure
+struct TreeNode {
+    int val;
+    TreeNode *left;
+    TreeNode *right;
+    TreeNode(int x) : val(x), left(nullptr), right(nullptr) {}
+};
+
+
+class PathIndex {
+public:
+    // Function to index the tree rooted at 'A'
+    // with its parent array and value lookup
+    PathIndex(TreeNode* A) {
+        if (A == NULL) {
+            return;
+        }
+        vector<pair<TreeNode*, uint32_t>> st;
+        st.push_back({A, uint32_t(noParent)});
+        while (!st.empty()) {
+            TreeNode* node = st.back().first;
+            uint32_t par = st.back().second;
+            st.pop_back();
+
+            uint32_t i = vals.size();
+            vals.push_back(node->val);
+            parent.push_back(par);
+            // Keep the first occurrence in preorder
+            // of a repeated value, as getPath does
+            position.emplace(node->val, i);
+
+            if (node->right) {
+                st.push_back({node->right, i});
+            }
+            if (node->left) {
+                st.push_back({node->left, i});
+            }
+        }
+    }
+
+    // Function to find and return the path from the root
+    // to the node with value 'B', the first one in
+    // preorder if several nodes hold it
+    vector<int> solve(int B) const {
+        vector<int> arr;
+        auto it = position.find(B);
+        if (it == position.end()) {
+            return arr;
+        }
+
+        // Walk up to the root, then reverse
+        for (uint32_t i = it->second; i != noParent; i = parent[i]) {
+            arr.push_back(vals[i]);
+        }
+        reverse(arr.begin(), arr.end());
+        return arr;
+    }
+
+    // Function to return the depth of the node with
+    // value 'B' (the root has depth 1), or 0 if absent
+    int depth(int B) const {
+        auto it = position.find(B);
+        if (it == position.end()) {
+            return 0;
+        }
+        int d = 0;
+        for (uint32_t i = it->second; i != noParent; i = parent[i]) {
+            d++;
+        }
+        return d;
+    }
+
+private:
+    // Parent of the root
+    static const uint32_t noParent = UINT32_MAX;
+
+    // Value and parent index of
+    // every node in preorder
+    vector<int> vals;
+    vector<uint32_t> parent;
+    unordered_map<int, uint32_t> position;
+};
+
+int main() {
+    TreeNode* root = new TreeNode(3);
+    root->left = new TreeNode(5);
+    root->right = new TreeNode(1);
+    root->left->left = new TreeNode(6);
+    root->left->right = new TreeNode(2);
+    root->right->left = new TreeNode(0);
+    root->right->right = new TreeNode(8);
+    root->left->right->left = new TreeNode(7);
+    root->left->right->right = new TreeNode(4);
+
+    // Built once, then every query
+    // takes O(depth)
+    PathIndex index(root);
+
+    for (int targetLeafValue : {7, 8, 3}) {
+        vector<int> path = index.solve(targetLeafValue);
+
+        cout << "Path from root to leaf with value " <<
+            targetLeafValue << ": ";
+        for (int i = 0; i < (int)path.size(); ++i) {
+            cout << path[i];
+            if (i < (int)path.size() - 1) {
+                cout << " -> ";
+            }
+        }
+        cout << endl;
+    }
+
+    return 0;
+}
+
+/*
+Time Complexity: O(N) once to build the index where N is the number of nodes in the binary tree, then O(D) expected per query where D is the depth of the node,
+as the value is located with one hash map lookup and the walk up visits only the nodes on the path.
+
+Space Complexity: O(N) for the values, the parent array of 4 bytes per node and the hash map. The traversal stack holds O(H) entries where H is the height of the tree.
+*/
+
+//Batch Paths Approach :
+/*
+Algorithm / Intuition
+Calling solve once per target walks the tree again for every target and builds a separate vector for every path,
+even though paths to nearby targets share most of their nodes, starting with the root.
+Instead we find all the targets in a single DFS and store the paths as a trie: the union of all the root to target paths is itself a small tree,
+in which every shared prefix is stored only once. Every trie node keeps its value, its parent in the trie and its depth, and every target keeps the trie node where its path ends and the length of its path.
+A path is then read by walking up from its end, and the LCA of two targets is the trie node where their paths meet. As the values are arbitrary integers, the LCA is returned as a trie node index and not as a value.
+
+The DFS keeps the current root to node path in an array indexed by depth, together with the trie node of every entry, or -1 while the entry is not in the trie yet.
+When the DFS reaches a target we add the entries of the current path that are not in the trie yet, which are always the deepest ones, so every trie node is created once.
+The DFS stops as soon as every target has been found.
+If only the lengths are needed, the depth of every target is recorded and no trie is built at all, and the batch holds only the lengths.
+
+Algorithm:
+Step 1: Map every target value to the indices of the queries asking for it.
+Step 2: Traverse the tree in preorder with an explicit stack of (node, depth). Store the node at path[depth] and mark it as not in the trie.
+Step 3: If the node is a target: going up from depth, find the deepest entry already in the trie, then create trie nodes for the entries below it, each with the previous one as its parent.
+Set the end of every query for this value to the trie node of the current node. Stop once all the targets are found.
+Step 4: path(k) walks up from end[k] and reverses, length(k) is the recorded depth, and lca(a, b) lifts the deeper end to the depth of the other and then lifts both until they meet.
+*/
+
+
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <optional>
+
+using namespace std;
+
+// TreeNode structure
+struct TreeNode {
+    int val;
+    TreeNode *left;
+    TreeNode *right;
+    TreeNode(int x) : val(x), left(nullptr), right(nullptr) {}
+};
+
+
+// Root to node paths of a batch of targets,
+// stored as a trie sharing common prefixes
+struct PathBatch {
+    // Value, parent and depth of every
+    // trie node, the root has parent -1
+    vector<int> val;
+    vector<int> parent;
+    vector<int> depth;
+    // Trie node where the path of every target ends,
+    // -1 if it was not found or no trie was built
+    vector<int> end;
+    // Number of nodes on the path of every
+    // target, 0 if it was not found
+    vector<int> targetDepth;
+
+    // Function to return the path
+    // from the root to target 'k'
+    vector<int> path(int k) const {
+        vector<int> arr;
+        for (int t = end[k]; t != -1; t = parent[t]) {
+            arr.push_back(val[t]);
+        }
+        reverse(arr.begin(), arr.end());
+        return arr;
+    }
+
+    // Function to return the number of nodes
+    // on the path to target 'k'
+    int length(int k) const {
+        return targetDepth[k];
+    }
+
+    // Function to return the trie node of the lowest
+    // common ancestor of targets 'a' and 'b', or -1
+    // if one of them was not found, its value is val[]
+    int lca(int a, int b) const {
+        int u = end[a], v = end[b];
+        if (u == -1 || v == -1) {
+            return -1;
+        }
+        while (depth[u] > depth[v]) {
+            u = parent[u];
+        }
+        while (depth[v] > depth[u]) {
+            v = parent[v];
+        }
+        while (u != v) {
+            u = parent[u];
+            v = parent[v];
+        }
+        return u;
+    }
+};
+
+class Solution {
+public:
+    // Function to find the paths from the root to
+    // every value in 'B' with one traversal, if
+    // 'lengthsOnly' the trie is not built
+    PathBatch solveBatch(TreeNode* A, const vector<int>& B, bool lengthsOnly = false) {
+        PathBatch batch;
+        batch.end.assign(B.size(), -1);
+        batch.targetDepth.assign(B.size(), 0);
+        if (A == NULL || B.empty()) {
+            return batch;
+        }
+
+        // Queries asking for every target value
+        unordered_map<int, vector<int>> queries;
+        for (int k = 0; k < (int)B.size(); k++) {
+            queries[B[k]].push_back(k);
+        }
+        size_t remaining = queries.size();
+
+        // Current path and the trie node
+        // of every entry, or -1
+        vector<TreeNode*> path;
+        vector<int> pathTrie;
+
+        vector<pair<TreeNode*, int>> st;
+        st.push_back({A, 0});
+        while (!st.empty() && remaining > 0) {
+            TreeNode* node = st.back().first;
+            int d = st.back().second;
+            st.pop_back();
+
+            path.resize(d + 1);
+            pathTrie.resize(d + 1);
+            path[d] = node;
+            pathTrie[d] = -1;
+
+            auto it = queries.find(node->val);
+            if (it != queries.end()) {
+                int t = -1;
+                if (!lengthsOnly) {
+                    t = addToTrie(batch, path, pathTrie, d);
+                }
+                for (int k : it->second) {
+                    batch.end[k] = t;
+                    batch.targetDepth[k] = d + 1;
+                }
+                queries.erase(it);
+                remaining--;
+            }
+
+            if (node->right) {
+                st.push_back({node->right, d + 1});
+            }
+            if (node->left) {
+                st.push_back({node->left, d + 1});
+            }
+        }
+        return batch;
+    }
+
+    // Function to return the number of nodes on
+    // the path to every value in 'B', 0 if absent
+    vector<int> pathLengths(TreeNode* A, const vector<int>& B) {
+        return solveBatch(A, B, true).targetDepth;
+    }
+
+    // Function to return the value of the lowest common
+    // ancestor of every pair of values, empty if one
+    // of the values is not in the tree
+    vector<optional<int>> lcaBatch(TreeNode* A, const vector<pair<int, int>>& pairs) {
+        vector<int> B;
+        for (auto& p : pairs) {
+            B.push_back(p.first);
+            B.push_back(p.second);
+        }
+        PathBatch batch = solveBatch(A, B);
+        vector<optional<int>> result;
+        for (int i = 0; i < (int)pairs.size(); i++) {
+            int t = batch.lca(2 * i, 2 * i + 1);
+            result.push_back(t == -1 ? nullopt : optional<int>(batch.val[t]));
+        }
+        return result;
+    }
+
+private:
+
+    // Function to add path[0 .. d] to the trie, creating only the
+    // entries not in it yet, and return the trie node of path[d]
+    int addToTrie(PathBatch& batch, const vector<TreeNode*>& path,
+            vector<int>& pathTrie, int d) {
+        // The entries missing from the
+        // trie are always the deepest ones
+        int j = d;
+        while (j >= 0 && pathTrie[j] == -1) {
+            j--;
+        }
+        for (int i = j + 1; i <= d; i++) {
+            pathTrie[i] = batch.val.size();
+            batch.val.push_back(path[i]->val);
+            batch.parent.push_back(i == 0 ? -1 : pathTrie[i - 1]);
+            batch.depth.push_back(i + 1);
+        }
+        return pathTrie[d];
+    }
+};
+
+int main() {
+    TreeNode* root = new TreeNode(3);
+    root->left = new TreeNode(5);
+    root->right = new TreeNode(1);
+    root->left->left = new TreeNode(6);
+    root->left->right = new TreeNode(2);
+    root->right->left = new TreeNode(0);
+    root->right->right = new TreeNode(8);
+    root->left->right->left = new TreeNode(7);
+    root->left->right->right = new TreeNode(4);
+
+    Solution sol;
+
+    vector<int> targets = {7, 4, 8, 9};
+    PathBatch batch = sol.solveBatch(root, targets);
+
+    for (int k = 0; k < (int)targets.size(); k++) {
+        vector<int> path = batch.path(k);
+        cout << "Path from root to leaf with value " <<
+            targets[k] << ": ";
+        for (int i = 0; i < (int)path.size(); ++i) {
+            cout << path[i];
+            if (i < (int)path.size() - 1) {
+                cout << " -> ";
+            }
+        }
+        cout << endl;
+    }
+    cout << "Trie nodes stored: " << batch.val.size() << endl;
+
+    vector<int> lengths = sol.pathLengths(root, targets);
+    cout << "Path lengths: ";
+    for (int len : lengths) {
+        cout << len << " ";
+    }
+    cout << endl;
+
+    vector<optional<int>> lcas = sol.lcaBatch(root, {{7, 4}, {6, 4}, {7, 8}, {7, 9}});
+    cout << "LCA of (7, 4), (6, 4), (7, 8), (7, 9): ";
+    for (const optional<int>& v : lcas) {
+        if (v) {
+            cout << *v << " ";
+        }
+        else {
+            cout << "none ";
+        }
+    }
+    cout << endl;
+
+    return 0;
+}
+
+/*
+Time Complexity: O(N + Q) where N is the number of nodes in the binary tree and Q the number of targets, as the tree is traversed once for the whole batch
+and every trie node is created once. Reading a path or answering an LCA takes O(D) where D is the depth of the targets.
+
+Space Complexity: O(T + Q) for the trie of T nodes, at most the total length of all the paths and usually much less as shared prefixes are stored once.
+The traversal stack and the current path hold O(H) entries where H is the height of the tree.
+*/
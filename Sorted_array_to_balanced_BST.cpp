@@ -0,0 +1,260 @@
+/*
+Problem Statement: Given a sorted array, build a height-balanced Binary Search Tree holding its values, so that the inorder traversal of the tree is the given array.
+*/
+
+/*
+Algorithm / Intuition
+Inserting the values one at a time costs O(log N) per insertion in a balanced tree, O(N log N) in total, and in a plain Binary Search Tree sorted insertions even build a chain.
+But if the values are already sorted we know the whole inorder sequence up front, so we only have to choose a balanced shape and write the values into it in inorder.
+
+We choose the shape of a Complete Binary Tree with N nodes: every level is full except possibly the last one, which is filled from the left.
+Its height is floor(log2 N) + 1, the smallest possible, so it is height-balanced.
+A complete tree can be stored in one array in BFS (level) order like a binary heap: the node at index i has its children at 2i + 1 and 2i + 2.
+So the nodes are allocated in one contiguous buffer and the child pointers follow directly from the indices.
+The buffer is returned inside a Tree that owns it, so every build has its own nodes and earlier trees stay valid.
+The upper levels, which every search passes through, sit together at the front of the buffer.
+
+To fill the values we run an iterative inorder traversal over the indices of the implicit complete tree and write the next sorted value into every visited node, which is O(N) in total.
+
+Parallel version: every subtree of the complete tree takes a contiguous range of the sorted array.
+We walk only the top few levels on the main thread, in inorder, treating every subtree below them as a block: the size of a subtree of a complete tree is computed level by level in O(log N),
+which gives the position of every block in the sorted array. The blocks are then filled independently by the threads, each writing only to the nodes of its own subtrees.
+Linking the child pointers only depends on the index of a node, so it is split into equal ranges across the threads.
+
+Algorithm:
+Step 1: Allocate a buffer of N nodes. For every index i set left = node 2i + 1 and right = node 2i + 2 if they are below N.
+Step 2: Inorder over the implicit tree using 1 based indices j: push j and move to 2j while j <= N. Pop j, write the next sorted value into node j - 1 and move to 2j + 1.
+Step 3 (parallel): traverse the top levels recursively in inorder. At the block depth record (j, next position) for every subtree and skip its size, otherwise write the next value.
+Distribute the blocks across the threads, each running Step 2 from the root of its blocks and their starting positions.
+*/
+
+
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <chrono>
+
+using namespace std;
+
+// TreeNode structure
+struct TreeNode {
+    int val;
+    TreeNode *left;
+    TreeNode *right;
+    TreeNode(int x) : val(x), left(nullptr), right(nullptr) {}
+};
+
+// Tree whose nodes live in one contiguous buffer
+// owned by the tree. It can be moved but not
+// copied, as the nodes point into the buffer
+struct Tree {
+    vector<TreeNode> nodes;
+    TreeNode* root = NULL;
+
+    Tree() = default;
+    Tree(Tree&&) = default;
+    Tree& operator=(Tree&&) = default;
+    Tree(const Tree&) = delete;
+    Tree& operator=(const Tree&) = delete;
+};
+
+class BalancedBuilder {
+public:
+    // Function to build a complete binary search tree
+    // from a sorted array, the nodes are stored in
+    // BFS order in the buffer of the returned tree
+    Tree build(const vector<int>& sorted) {
+        Tree tree;
+        long long n = sorted.size();
+        if (n == 0) {
+            return tree;
+        }
+        tree.nodes.assign(n, TreeNode(0));
+        TreeNode* nodes = tree.nodes.data();
+        link(nodes, n, 0, n);
+        fillSubtree(nodes, sorted, 1, 0, n);
+        tree.root = &nodes[0];
+        return tree;
+    }
+
+    // Function to build the same tree using 'numThreads'
+    // threads, each filling its own subtrees
+    Tree buildParallel(const vector<int>& sorted, int numThreads) {
+        Tree tree;
+        long long n = sorted.size();
+        if (n == 0) {
+            return tree;
+        }
+        tree.nodes.assign(n, TreeNode(0));
+        TreeNode* nodes = tree.nodes.data();
+
+        // Link the child pointers in equal ranges
+        vector<thread> workers;
+        for (int t = 0; t < numThreads; t++) {
+            workers.emplace_back([this, nodes, n, t, numThreads] {
+                link(nodes, n, n * t / numThreads, n * (t + 1) / numThreads);
+            });
+        }
+        for (auto& w : workers) {
+            w.join();
+        }
+        workers.clear();
+
+        // Pick a block depth with a few
+        // subtrees per thread
+        int blockDepth = 0;
+        while ((1 << blockDepth) < 4 * numThreads) {
+            blockDepth++;
+        }
+
+        // Walk the top levels in inorder and find
+        // the sorted position of every block
+        vector<pair<long long, long long>> blocks;
+        long long pos = 0;
+        fillTop(nodes, sorted, 1, 0, blockDepth, pos, blocks);
+
+        // Fill the blocks in parallel
+        for (int t = 0; t < numThreads; t++) {
+            workers.emplace_back([&, t] {
+                for (size_t b = t; b < blocks.size(); b += numThreads) {
+                    fillSubtree(nodes, sorted, blocks[b].first, blocks[b].second, n);
+                }
+            });
+        }
+        for (auto& w : workers) {
+            w.join();
+        }
+        tree.root = &nodes[0];
+        return tree;
+    }
+
+private:
+    // Function to link every node in [from, to)
+    // to its children at 2i + 1 and 2i + 2
+    void link(TreeNode* nodes, long long n, long long from, long long to) {
+        for (long long i = from; i < to; i++) {
+            nodes[i].left = 2 * i + 1 < n ? &nodes[2 * i + 1] : NULL;
+            nodes[i].right = 2 * i + 2 < n ? &nodes[2 * i + 2] : NULL;
+        }
+    }
+
+    // Function to write sorted[pos ...] in inorder into
+    // the subtree with 1 based index j, iteratively
+    void fillSubtree(TreeNode* nodes, const vector<int>& sorted, long long j, long long pos, long long n) {
+        vector<long long> st;
+        while (j <= n || !st.empty()) {
+            // Go down to the leftmost node
+            while (j <= n) {
+                st.push_back(j);
+                j = 2 * j;
+            }
+            j = st.back();
+            st.pop_back();
+            nodes[j - 1].val = sorted[pos++];
+            j = 2 * j + 1;
+        }
+    }
+
+    // Function to return the number of nodes in the subtree
+    // with 1 based index j of a complete tree with n nodes
+    long long subtreeSize(long long j, long long n) {
+        long long size = 0;
+        for (long long first = j, width = 1; first <= n; first *= 2, width *= 2) {
+            size += min(first + width - 1, n) - first + 1;
+        }
+        return size;
+    }
+
+    // Function to walk the top levels in inorder, writing the
+    // values of the top nodes and recording the starting
+    // sorted position of every subtree at 'blockDepth'
+    void fillTop(TreeNode* nodes, const vector<int>& sorted, long long j, int depth, int blockDepth,
+            long long& pos, vector<pair<long long, long long>>& blocks) {
+        long long n = sorted.size();
+        if (j > n) {
+            return;
+        }
+        if (depth == blockDepth) {
+            blocks.push_back({j, pos});
+            pos += subtreeSize(j, n);
+            return;
+        }
+        fillTop(nodes, sorted, 2 * j, depth + 1, blockDepth, pos, blocks);
+        nodes[j - 1].val = sorted[pos++];
+        fillTop(nodes, sorted, 2 * j + 1, depth + 1, blockDepth, pos, blocks);
+    }
+};
+
+// Function to print the
+// inorder traversal of a tree
+void printInorder(TreeNode* root) {
+    if (!root) {
+        return;
+    }
+    printInorder(root->left);
+    cout << root->val << " ";
+    printInorder(root->right);
+}
+
+// Function to return the height of a tree
+int height(TreeNode* root) {
+    if (!root) {
+        return 0;
+    }
+    return 1 + max(height(root->left), height(root->right));
+}
+
+int main() {
+    // Sorted input, for example the
+    // output of getInorder
+    vector<int> sorted = {1, 3, 4, 7, 9, 12, 15, 18, 20, 25};
+
+    BalancedBuilder builder;
+    Tree tree = builder.build(sorted);
+    TreeNode* root = tree.root;
+
+    cout << "Inorder of the balanced tree: ";
+    printInorder(root);
+    cout << endl;
+    cout << "Root: " << root->val << ", height: " << height(root) << endl;
+
+    // Time the sequential and the
+    // parallel build on a large input
+    int n = 1 << 24;
+    sorted.resize(n);
+    for (int i = 0; i < n; i++) {
+        sorted[i] = 2 * i;
+    }
+    int numThreads = max(1u, thread::hardware_concurrency());
+
+    auto start = chrono::steady_clock::now();
+    Tree big = builder.build(sorted);
+    auto mid = chrono::steady_clock::now();
+    Tree bigParallel = builder.buildParallel(sorted, numThreads);
+    auto end = chrono::steady_clock::now();
+
+    cout << "n = " << n << ": sequential "
+         << chrono::duration<double, milli>(mid - start).count() << " ms, parallel on "
+         << numThreads << " threads "
+         << chrono::duration<double, milli>(end - mid).count() << " ms" << endl;
+
+    // Every tree owns its nodes, so the first
+    // tree is still valid after the later builds
+    bool same = true;
+    for (int i = 0; i < n; i++) {
+        same = same && big.nodes[i].val == bigParallel.nodes[i].val;
+    }
+    cout << "First tree still has root " << root->val
+         << ", both large trees are equal: " << same << endl;
+
+    return 0;
+}
+
+/*
+Time Complexity: O(N) where N is the number of values. Every node is linked once and receives its value once during the inorder walk.
+The parallel version does the same work split across P threads, plus O(P log N) on the main thread for the top levels and the block sizes.
+
+Space Complexity: O(N) for the contiguous buffer of N nodes, owned by the returned Tree.
+The inorder walk keeps a stack of at most log2N indices as the tree is complete, and the parallel version keeps O(P) blocks.
+*/
@@ -0,0 +1,293 @@
+/*
+Problem Statement: Given a Binary Tree that contains many repeated identical subtrees, store every distinct subtree only once,
+turning the tree into a DAG (directed acyclic graph) on which the read-only algorithms still work unchanged, and report how much memory this saves.
+*/
+
+/*
+Algorithm / Intuition
+Two subtrees are identical when their roots hold the same value and their left subtrees and right subtrees are identical, see Check if two trees are identical.
+If we make sure that identical subtrees are always represented by the same node, this check becomes trivial: two subtrees are identical exactly when their roots are the same pointer.
+This technique is called hash-consing. We keep a table of canonical nodes keyed by (value, left child pointer, right child pointer).
+To create a node whose children are already canonical, we look its key up in the table and return the existing node if there is one, otherwise we create it and add it.
+As the children are canonical, equal keys mean identical subtrees, so the table never confuses two different subtrees, and no deep comparison is ever needed.
+
+Deduplicating an existing tree: we visit the nodes in postorder, so both children of a node are canonical before the node itself.
+We point the node to the canonical versions of its children and look up its key. If the key is new the node becomes canonical, otherwise it is a duplicate and its parent will point to the canonical node instead.
+The duplicates are freed at the end, and the difference in node counts gives the memory saved on nodes.
+The table itself is not free: it keeps one entry per distinct subtree plus its bucket array, and it has to stay alive for make() to keep sharing subtrees.
+So the net saving is the node bytes saved minus the size of the table, which is negative when the tree has few repeated subtrees.
+
+The read-only algorithms such as traversals, height, the symmetric check and the views only follow child pointers and never write to the nodes, so they run unchanged on the DAG
+and give the same answers as on the original tree, because every path from the root still sees the same values in the same shape.
+A node can now have several parents, so the DAG must not be modified in place: changing one shared node would change every copy of that subtree.
+
+Algorithm:
+Step 1: make(value, left, right): look up the key (value, left, right) in the table. Return the node found, or create a new node, add it to the table and return it.
+Step 2: dedup(root): traverse the tree in postorder with an explicit stack. For every node replace both children with their canonical nodes, then look up the node's key.
+If it is found and is another node, record the canonical node for this node and mark this node as a duplicate. Otherwise the node is canonical: add it to the table if it is not there yet.
+A node reached a second time, because the input is already a DAG or was built with make(), is skipped, so it is counted once and never freed while it is still shared.
+Running dedup again on its own result, or on a tree built with make(), finds every node in the table already and frees nothing.
+Step 3: Free the duplicate nodes and report the number of nodes before and after, the node bytes saved, the estimated size of the table and the net bytes saved.
+*/
+
+
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <algorithm>
+
+using namespace std;
+
+// Node structure for the binary tree
+struct Node {
+    int data;
+    Node* left;
+    Node* right;
+    // Constructor to initialize
+    // the node with a value
+    Node(int val) : data(val), left(nullptr), right(nullptr) {}
+};
+
+// Key identifying a subtree whose
+// children are already canonical
+struct NodeKey {
+    int data;
+    Node* left;
+    Node* right;
+    bool operator==(const NodeKey& other) const {
+        return data == other.data && left == other.left && right == other.right;
+    }
+};
+
+struct NodeKeyHash {
+    size_t operator()(const NodeKey& k) const {
+        uint64_t h = (uint64_t)(uint32_t)k.data * 0x9e3779b97f4a7c15ull;
+        h ^= (uint64_t)(uintptr_t)k.left + 0x7f4a7c15ull + (h << 6) + (h >> 2);
+        h ^= (uint64_t)(uintptr_t)k.right + 0x9e3779b9ull + (h << 6) + (h >> 2);
+        return h;
+    }
+};
+
+// Memory report of a deduplication pass
+struct DedupReport {
+    long long nodesBefore;
+    long long nodesAfter;
+    // Bytes of the freed nodes, the estimated
+    // size of the table, and their difference
+    long long nodeBytesSaved;
+    long long tableBytes;
+    long long bytesSaved;
+};
+
+class HashConsing {
+public:
+    // Function to return the canonical node for
+    // (val, left, right), creating it if needed,
+    // 'left' and 'right' must be canonical
+    Node* make(int val, Node* left, Node* right) {
+        NodeKey key = {val, left, right};
+        auto it = table.find(key);
+        if (it != table.end()) {
+            return it->second;
+        }
+        Node* node = new Node(val);
+        node->left = left;
+        node->right = right;
+        table.emplace(key, node);
+        return node;
+    }
+
+    // Function to turn a tree into a DAG sharing all
+    // identical subtrees, returns the new root and
+    // fills the memory report
+    Node* dedup(Node* root, DedupReport& report) {
+        report = {0, 0, 0, 0, 0};
+        if (root == NULL) {
+            return NULL;
+        }
+
+        // Canonical node of every visited node, a node
+        // that is canonical maps to itself, it also marks
+        // the shared nodes that were already processed
+        unordered_map<Node*, Node*> canon;
+        vector<Node*> duplicates;
+
+        // Iterative postorder: a node is processed
+        // once both its children are done
+        vector<pair<Node*, bool>> st;
+        st.push_back({root, false});
+        while (!st.empty()) {
+            Node* node = st.back().first;
+            bool childrenDone = st.back().second;
+            st.pop_back();
+
+            // A shared node is processed only once
+            if (canon.count(node)) {
+                continue;
+            }
+
+            if (!childrenDone) {
+                st.push_back({node, true});
+                if (node->right) {
+                    st.push_back({node->right, false});
+                }
+                if (node->left) {
+                    st.push_back({node->left, false});
+                }
+                continue;
+            }
+
+            report.nodesBefore++;
+
+            // Point the node to the canonical
+            // versions of its children
+            if (node->left) {
+                node->left = canon[node->left];
+            }
+            if (node->right) {
+                node->right = canon[node->right];
+            }
+
+            // The node found in the table may be this node
+            // itself, which is then already canonical
+            NodeKey key = {node->data, node->left, node->right};
+            auto it = table.find(key);
+            if (it != table.end() && it->second != node) {
+                canon[node] = it->second;
+                duplicates.push_back(node);
+            }
+            else if (it != table.end()) {
+                canon[node] = node;
+            }
+            else {
+                table.emplace(key, node);
+                canon[node] = node;
+            }
+        }
+
+        Node* newRoot = canon[root];
+        for (Node* node : duplicates) {
+            delete node;
+        }
+
+        report.nodesAfter = report.nodesBefore - duplicates.size();
+        report.nodeBytesSaved = (report.nodesBefore - report.nodesAfter) * (long long)sizeof(Node);
+        report.tableBytes = tableBytes();
+        report.bytesSaved = report.nodeBytesSaved - report.tableBytes;
+        return newRoot;
+    }
+
+    // Function to estimate the memory used by the table:
+    // the bucket array, and for every entry the key, the
+    // node pointer, the cached hash and the link to the next entry
+    long long tableBytes() const {
+        long long entry = sizeof(pair<const NodeKey, Node*>) + sizeof(size_t) + sizeof(void*);
+        return (long long)table.bucket_count() * sizeof(void*) + (long long)table.size() * entry;
+    }
+
+private:
+    // Table of canonical nodes
+    unordered_map<NodeKey, Node*, NodeKeyHash> table;
+};
+
+// Read-only algorithms from the other
+// problems, unchanged
+
+// Function to print the
+// inorder traversal of a tree
+void printInorder(Node* root) {
+    if (!root) {
+        return;
+    }
+    printInorder(root->left);
+    cout << root->data << " ";
+    printInorder(root->right);
+}
+
+// Function to return the height of a tree
+int maxDepth(Node* root) {
+    if (root == NULL) {
+        return 0;
+    }
+    return 1 + max(maxDepth(root->left), maxDepth(root->right));
+}
+
+// Function to check if two
+// subtrees are mirror images
+bool isSymmetricUtil(Node* root1, Node* root2) {
+    if (root1 == NULL || root2 == NULL) {
+        return root1 == root2;
+    }
+    return (root1->data == root2->data)
+        && isSymmetricUtil(root1->left, root2->right)
+        && isSymmetricUtil(root1->right, root2->left);
+}
+
+// Function to build a subtree made
+// of repeated identical parts
+Node* buildRepeated(int depth) {
+    Node* node = new Node(depth % 3);
+    if (depth > 1) {
+        node->left = buildRepeated(depth - 1);
+        node->right = buildRepeated(depth - 1);
+    }
+    return node;
+}
+
+int main() {
+    // A perfect tree whose values only depend on the
+    // level, so every level holds identical subtrees
+    Node* root = buildRepeated(12);
+
+    cout << "Before: height " << maxDepth(root)
+         << ", symmetric " << isSymmetricUtil(root->left, root->right) << endl;
+
+    HashConsing hc;
+    DedupReport report;
+    root = hc.dedup(root, report);
+
+    cout << "After: height " << maxDepth(root)
+         << ", symmetric " << isSymmetricUtil(root->left, root->right) << endl;
+    cout << "Nodes before: " << report.nodesBefore
+         << ", nodes after: " << report.nodesAfter
+         << ", bytes saved on nodes: " << report.nodeBytesSaved
+         << ", table: " << report.tableBytes
+         << ", net bytes saved: " << report.bytesSaved << endl;
+
+    // A second pass over the DAG finds every
+    // node canonical already and frees nothing
+    root = hc.dedup(root, report);
+    cout << "Second pass: nodes before: " << report.nodesBefore
+         << ", nodes after: " << report.nodesAfter
+         << ", height " << maxDepth(root) << endl;
+
+    // Building new trees through make() shares
+    // subtrees with everything built before
+    Node* leaf = hc.make(0, NULL, NULL);
+    Node* small = hc.make(5, leaf, leaf);
+    Node* again = hc.make(5, hc.make(0, NULL, NULL), hc.make(0, NULL, NULL));
+    cout << "Identical subtrees share one node: " << (small == again) << endl;
+    cout << "Inorder of the shared subtree: ";
+    printInorder(again);
+    cout << endl;
+
+    // A tree built with make() is already
+    // deduplicated and stays readable
+    Node* built = hc.make(7, small, hc.make(5, leaf, leaf));
+    built = hc.dedup(built, report);
+    cout << "Dedup of a built tree frees " << report.nodesBefore - report.nodesAfter
+         << " nodes, inorder: ";
+    printInorder(built);
+    cout << endl;
+
+    return 0;
+}
+
+/*
+Time Complexity: O(N) expected, where N is the number of nodes in the original tree.
+Every node is visited once and does a constant number of hash table operations. The key holds child pointers instead of whole subtrees, so it is hashed and compared in O(1).
+
+Space Complexity: O(D) for the table of canonical nodes where D is the number of distinct subtrees, plus O(N) for the map of canonical nodes and the stack during the pass.
+After the pass only the D distinct nodes remain, so a tree of N nodes shrinks by (N - D) * sizeof(Node) bytes, while the table keeps O(D) entries for as long as it is used.
+*/
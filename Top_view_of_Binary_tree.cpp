@@ -150,4 +150,179 @@ It acquires space proportional to the number of nodes in the level it is explori
 Additionally, the map is used to store the top view nodes based on their vertical positions hence its complexity will also be proportional to the greatest width level. 
 In the worst case, it may have N/2 entries as well.
 */
-                        
\ No newline at end of file
+                        
+
+//Top and Bottom View in one BFS using Column Arrays :
+/*
+Algorithm / Intuition
+The map in the solution above is only used to keep the vertical positions sorted, but the vertical positions of a Binary Tree are never arbitrary.
+A child is always exactly one column to the left or to the right of its parent, hence the columns seen so far always form one contiguous range [minCol, maxCol].
+This means we can replace the map with a plain array indexed by (column + offset), where the offset is the index at which column 0 is stored.
+Moving right past maxCol simply appends at the back of the array. Moving left past minCol needs room at the front, so whenever the front runs out we double the array and shift the existing columns to the right half.
+Doubling makes the growth amortized O(1) per column, just like push_back.
+Since the range is contiguous, a column is visited for the first time exactly when it extends the range. That node is the highest node of its column so it belongs to the top view.
+The bottom view only needs the last node seen at every column in level order, so we can overwrite it on every visit and compute both views in the same BFS.
+
+Algorithm:
+Step 1: If the tree is empty, return two empty vectors.
+Step 2: Create the `top` and `bottom` column arrays holding column 0 at index `offset` and set minCol = maxCol = 0. Use a flat array with a head index as the BFS queue, each entry holding the node and its vertical position.
+Once the popped entries before the head make up half of the array, erase them, so the array only ever holds about twice the entries waiting in the queue.
+Step 3: While the queue is not empty, take the front node and its vertical position ‘line’:
+If line < minCol, make sure there is room at the front of the arrays (doubling them if needed), store the node in the top view and update minCol.
+If line > maxCol, append the node to the top view and update maxCol.
+Always overwrite the bottom view at this column with the node’s data.
+Enqueue the left child with line - 1 and the right child with line + 1.
+Step 4: The columns [minCol, maxCol] are stored in order at indices [minCol + offset, maxCol + offset], copy them into the result vectors.
+*/
+
+
+#include <iostream>
+#include <vector>
+#include <utility>
+
+using namespace std;
+
+// Node structure for the binary tree
+struct Node {
+    int data;
+    Node* left;
+    Node* right;
+    // Constructor to initialize
+    // the node with a value
+    Node(int val) : data(val), left(nullptr), right(nullptr) {}
+};
+
+class Solution{
+public:
+    // Function to return the top view and
+    // the bottom view of the binary tree
+    pair<vector<int>, vector<int>> topAndBottomView(Node* root){
+        // Vectors to store the result
+        pair<vector<int>, vector<int>> ans;
+
+        // Check if the tree is empty
+        if(root == NULL){
+            return ans;
+        }
+
+        // Column arrays, column 'line' is
+        // stored at index line + offset
+        vector<int> top(1), bottom(1);
+        int offset = 0;
+        int minCol = 0, maxCol = 0;
+        top[0] = root->data;
+
+        // Flat array used as the BFS queue, each
+        // entry holds a node and its vertical position
+        vector<pair<Node*, int>> q;
+        q.push_back({root, 0});
+        size_t head = 0;
+
+        // BFS traversal
+        while(head < q.size()){
+            Node* node = q[head].first;
+            int line = q[head].second;
+            head++;
+
+            if(line < minCol){
+                // Grow the arrays at the front by
+                // doubling when there is no room left
+                if(line + offset < 0){
+                    growFront(top, bottom, offset);
+                }
+                // First node of a new column
+                // on the left is the top view
+                top[line + offset] = node->data;
+                minCol = line;
+            }
+            else if(line > maxCol){
+                // First node of a new column
+                // on the right is the top view
+                top.push_back(node->data);
+                bottom.push_back(node->data);
+                maxCol = line;
+            }
+
+            // The last node seen in level order
+            // at a column is the bottom view
+            bottom[line + offset] = node->data;
+
+            // Process left child
+            if(node->left != NULL){
+                q.push_back({node->left, line - 1});
+            }
+
+            // Process right child
+            if(node->right != NULL){
+                q.push_back({node->right, line + 1});
+            }
+
+            // Drop the popped entries once they are half
+            // of the array, moving at most as many entries
+            // as were popped since the last compaction
+            if(head >= 64 && 2 * head >= q.size()){
+                q.erase(q.begin(), q.begin() + head);
+                head = 0;
+            }
+        }
+
+        // Transfer the used columns
+        // to the result vectors
+        ans.first.assign(top.begin() + minCol + offset, top.begin() + maxCol + offset + 1);
+        ans.second.assign(bottom.begin() + minCol + offset, bottom.begin() + maxCol + offset + 1);
+        return ans;
+    }
+
+private:
+    // Function to double the column arrays and
+    // move the existing columns to the right half
+    void growFront(vector<int>& top, vector<int>& bottom, int& offset){
+        int extra = top.size();
+        top.insert(top.begin(), extra, 0);
+        bottom.insert(bottom.begin(), extra, 0);
+        offset += extra;
+    }
+};
+
+int main() {
+    // Creating a sample binary tree
+    Node* root = new Node(1);
+    root->left = new Node(2);
+    root->left->left = new Node(4);
+    root->left->right = new Node(10);
+    root->left->left->right = new Node(5);
+    root->left->left->right->right = new Node(6);
+    root->right = new Node(3);
+    root->right->right = new Node(10);
+    root->right->left = new Node(9);
+
+    Solution solution;
+
+    // Get the top and bottom view traversal
+    pair<vector<int>, vector<int>> views =
+                    solution.topAndBottomView(root);
+
+    // Print the result
+    cout << "Top View Traversal: "<< endl;
+    for(auto node: views.first){
+        cout << node << " ";
+    }
+    cout << endl;
+
+    cout << "Bottom View Traversal: "<< endl;
+    for(auto node: views.second){
+        cout << node << " ";
+    }
+    cout << endl;
+
+    return 0;
+}
+
+/*
+Time Complexity: O(N) where N is the number of nodes in the Binary Tree. Every node is visited exactly once during the BFS traversal and every step is O(1) amortized.
+Growing the arrays at the front doubles them, so the total work spent shifting columns is proportional to the final number of columns.
+
+Space Complexity: O(L + W) where L is the maximum number of nodes on one level and W is the number of columns.
+The BFS array holds the entries waiting in the queue, at most the widest level, plus at most as many popped entries before they are erased. The column arrays hold at most 2W entries.
+There is no red-black tree node per column as with the map.
+*/
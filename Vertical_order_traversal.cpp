@@ -131,9 +131,9 @@ public:
         // Prepare the final result vector
         // by combining values from the map
         vector<vector<int>> ans;
-        for(auto p: nodes){
+        for(const auto& p: nodes){
             vector<int> col;
-            for(auto q: p.second){
+            for(const auto& q: p.second){
                 // Insert node values
                 // into the column vector
                 col.insert(col.end(), q.second.begin(), q.second.end());
@@ -183,4 +183,543 @@ int main() {
     return 0;
 }
                             
-                        
\ No newline at end of file
+                        
+
+//Two-Pass Flat Bucket Approach :
+/*
+Algorithm / Intuition
+The map based solution above inserts every node into a map of maps of multisets which costs three tree node allocations and O(log) comparisons per node.
+We can avoid all of these allocations by observing that the columns of a Binary Tree always form a contiguous range [minCol, maxCol].
+Hence a column can be used directly as an index into an array once we shift it by -minCol.
+In the first pass we perform a level order BFS and record every node with its vertical and level information in a flat array.
+While doing so we also track the leftmost and the rightmost column.
+Now we count how many nodes fall into each column and take a prefix sum over these counts which gives us the starting offset of every column in one flat output array.
+In the second pass we scatter the nodes into their column buckets. Since the first pass visited the nodes in level order, the nodes inside a column bucket are already sorted by their level.
+The only thing left is the tie-breaking of the multiset: nodes sharing the same column and the same level must appear in sorted order of their values.
+Such nodes form a contiguous run inside the column bucket so we sort only the runs that hold more than one node.
+
+Algorithm:
+Step 1: If the tree is empty return an empty result.
+Step 2: Perform a BFS using a flat array as the queue. Each entry holds the node, its vertical ‘x’ and its level ‘y’. Track the minimum and the maximum vertical seen.
+Step 3: Create a count array of size (maxCol - minCol + 1) and count the nodes in every column. Convert the counts into starting offsets using a prefix sum.
+Step 4: Walk the BFS array in order and write each node’s value and level into the flat bucket arrays at the offset of its column.
+Step 5: Inside every column bucket find runs of nodes with the same level. If a run holds more than one node, sort it by value.
+Step 6: Copy every column bucket into its column vector of the final result and return it.
+*/
+
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+// Node structure for the binary tree
+struct Node {
+    int data;
+    Node* left;
+    Node* right;
+    // Constructor to initialize
+    // the node with a value
+    Node(int val) : data(val), left(nullptr), right(nullptr) {}
+};
+
+// Entry of the flat BFS array holding
+// a node with its vertical and level
+struct Entry {
+    Node* node;
+    int x;
+    int y;
+};
+
+class Solution {
+public:
+    // Function to perform vertical order traversal
+    // and return a 2D vector of node values
+    vector<vector<int>> findVertical(Node* root){
+        vector<vector<int>> ans;
+
+        // Check if the tree is empty
+        if(root == nullptr){
+            return ans;
+        }
+
+        // First pass: BFS using a flat array
+        // as the queue, the array keeps every
+        // node in level order once we are done
+        vector<Entry> order;
+        order.push_back({root, 0, 0});
+        int minCol = 0, maxCol = 0;
+        for(size_t head = 0; head < order.size(); head++){
+            // Copy the entry as push_back
+            // may reallocate the array
+            Entry e = order[head];
+            minCol = min(minCol, e.x);
+            maxCol = max(maxCol, e.x);
+
+            // Process left child
+            if(e.node->left){
+                order.push_back({e.node->left, e.x - 1, e.y + 1});
+            }
+
+            // Process right child
+            if(e.node->right){
+                order.push_back({e.node->right, e.x + 1, e.y + 1});
+            }
+        }
+
+        // Count the nodes in every column and
+        // turn the counts into starting offsets
+        int width = maxCol - minCol + 1;
+        vector<int> start(width + 1, 0);
+        for(const Entry& e : order){
+            start[e.x - minCol + 1]++;
+        }
+        for(int c = 0; c < width; c++){
+            start[c + 1] += start[c];
+        }
+
+        // Second pass: scatter values and levels
+        // into the preallocated flat buckets
+        int n = order.size();
+        vector<int> values(n), levels(n);
+        vector<int> fill(start.begin(), start.end() - 1);
+        for(const Entry& e : order){
+            int pos = fill[e.x - minCol]++;
+            values[pos] = e.node->data;
+            levels[pos] = e.y;
+        }
+
+        // Prepare the final result, sorting only
+        // the runs of nodes that share both the
+        // column and the level
+        ans.resize(width);
+        for(int c = 0; c < width; c++){
+            int i = start[c];
+            int end = start[c + 1];
+            while(i < end){
+                int j = i + 1;
+                while(j < end && levels[j] == levels[i]){
+                    j++;
+                }
+                if(j - i > 1){
+                    sort(values.begin() + i, values.begin() + j);
+                }
+                i = j;
+            }
+            ans[c].assign(values.begin() + start[c], values.begin() + end);
+        }
+        return ans;
+    }
+};
+
+// Helper function to
+// print the result
+void printResult(const vector<vector<int>>& result) {
+    for(const auto& level: result){
+        for(auto node: level){
+            cout << node << " ";
+        }
+        cout << endl;
+    }
+    cout << endl;
+}
+
+int main() {
+    // Creating a sample binary tree
+    Node* root = new Node(1);
+    root->left = new Node(2);
+    root->left->left = new Node(4);
+    root->left->right = new Node(10);
+    root->left->left->right = new Node(5);
+    root->left->left->right->right = new Node(6);
+    root->right = new Node(3);
+    root->right->right = new Node(10);
+    root->right->left = new Node(9);
+
+    Solution solution;
+
+    // Get the Vertical traversal
+    vector<vector<int>> verticalTraversal =
+                    solution.findVertical(root);
+
+    // Print the result
+    cout << "Vertical Traversal: ";
+    printResult(verticalTraversal);
+
+    return 0;
+}
+
+/*
+Time Complexity: O(N + W + N log K) where N is the number of nodes, W is the number of columns and K is the size of the largest run of nodes sharing both column and level.
+Each pass touches every node once and no per node allocation is made. The sort only runs inside the buckets which hold more than one node, in most trees these are tiny.
+
+Space Complexity: O(N + W) where N is the number of nodes in the Binary Tree and W is the number of columns.
+The BFS array and the two flat bucket arrays hold N entries each and the offsets array holds W + 1 entries, there is no map or multiset node overhead.
+*/
+
+//Parallel Approach with Per-Thread Buckets and Radix Sort :
+/*
+Algorithm / Intuition
+Even with flat buckets the traversal above runs on a single thread. To use every core we have to split both the traversal and the ordering step.
+The order required by the vertical traversal is fully described by the triple (column, level, value): nodes are ordered by column first, then by level and the multiset tie-breaks equal positions by value.
+Hence if every node emits its triple, sorting all triples by (column, level, value) reproduces exactly the output of the map based solution.
+
+Splitting the traversal: a subtree rooted at a node with known (column, level) can be traversed independently of the rest of the tree.
+So we expand the tree level by level on the main thread until the frontier holds a few subtrees per thread, emitting the triples of the expanded nodes directly.
+The frontier subtrees are then handed out to the threads, every thread runs an iterative DFS over its subtrees and writes triples into its own buffer. No locks are needed.
+The expansion is capped at a few levels more than a balanced tree needs. A chain or a skewed tree never grows a wide frontier, and expanding it level by level
+would walk the whole tree on the main thread. If the frontier still holds fewer subtrees than there are threads there is nothing to run in parallel,
+so we run the sequential two-pass flat bucket solution from above instead.
+
+Splitting the sort: an LSD radix sort sorts by the least significant key first and relies on every pass being stable.
+We sort by value, then by level and finally by column, one byte per pass. A pass is parallelised by letting every thread build a histogram of its own chunk,
+computing the output offset of every (digit, thread) pair with a prefix sum, and letting every thread scatter its chunk to its offsets. Since the chunks are in order, the pass is stable.
+The columns are shifted by -minCol so all keys are unsigned and only the bytes that actually vary are sorted, a pass whose digits are all equal is skipped.
+
+Algorithm:
+Step 1: If the tree is empty return an empty result.
+Step 2: Expand the tree in level order from the root while the frontier holds fewer than 4 subtrees per thread, for at most log2(4P) + 4 levels where P is the number of threads.
+Emit the triple of every expanded node and push its children with their (column, level). If the frontier holds fewer than P subtrees, return the result of the two-pass flat bucket solution.
+Step 3: Distribute the frontier subtrees round robin across the threads. Each thread runs an iterative DFS using an explicit stack and appends (column, level, value) triples to its thread-local buffer, tracking its own minimum and maximum column.
+Step 4: Concatenate the buffers into one array, converting every triple into unsigned keys: value with the sign bit flipped, level, and column - minCol.
+Step 5: Run the parallel stable radix passes over the value, the level and the column keys, least significant byte first.
+Step 6: Walk the sorted array and append every value to the vector of its column.
+*/
+
+
+#include <iostream>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+
+using namespace std;
+
+// Node structure for the binary tree
+struct Node {
+    int data;
+    Node* left;
+    Node* right;
+    // Constructor to initialize
+    // the node with a value
+    Node(int val) : data(val), left(nullptr), right(nullptr) {}
+};
+
+// Node emitted by the traversal with
+// its vertical and level information
+struct Triple {
+    int x;
+    int y;
+    int value;
+};
+
+// Sort keys of a node, key[0] is the value,
+// key[1] the level and key[2] the column
+struct Keys {
+    uint32_t key[3];
+};
+
+// Entry of the flat BFS array holding
+// a node with its vertical and level
+struct Entry {
+    Node* node;
+    int x;
+    int y;
+};
+
+class Solution {
+public:
+    // Function to perform vertical order traversal on
+    // multiple threads and return a 2D vector of node values
+    vector<vector<int>> findVertical(Node* root){
+        vector<vector<int>> ans;
+
+        // Check if the tree is empty
+        if(root == nullptr){
+            return ans;
+        }
+
+        int numThreads = max(1u, thread::hardware_concurrency());
+
+        // Levels a balanced tree needs to reach 4 subtrees
+        // per thread, plus a few for trees that are not
+        int maxLevels = 4;
+        while((1 << maxLevels) < 4 * numThreads){
+            maxLevels++;
+        }
+        maxLevels += 4;
+
+        // Expand the top of the tree on the main
+        // thread until there are enough subtrees
+        // to keep all the threads busy
+        vector<Triple> top;
+        vector<pair<Node*, Triple>> frontier, next;
+        frontier.push_back({root, {0, 0, root->data}});
+        for(int level = 0; level < maxLevels && !frontier.empty()
+                && frontier.size() < 4 * (size_t)numThreads; level++){
+            next.clear();
+            for(auto& f : frontier){
+                Node* node = f.first;
+                int x = f.second.x, y = f.second.y;
+                top.push_back(f.second);
+                if(node->left){
+                    next.push_back({node->left, {x - 1, y + 1, node->left->data}});
+                }
+                if(node->right){
+                    next.push_back({node->right, {x + 1, y + 1, node->right->data}});
+                }
+            }
+            frontier.swap(next);
+        }
+
+        // The tree did not branch out enough,
+        // a chain gains nothing from threads
+        if(frontier.size() < (size_t)numThreads){
+            return findVerticalSequential(root);
+        }
+
+        // Traverse the frontier subtrees in parallel,
+        // every thread owns its own output buffer
+        vector<vector<Triple>> buffers(numThreads);
+        runParallel(numThreads, [&](int t){
+            vector<pair<Node*, Triple>> st;
+            for(size_t i = t; i < frontier.size(); i += numThreads){
+                st.push_back(frontier[i]);
+                while(!st.empty()){
+                    Node* node = st.back().first;
+                    Triple p = st.back().second;
+                    st.pop_back();
+                    buffers[t].push_back(p);
+                    if(node->right){
+                        st.push_back({node->right, {p.x + 1, p.y + 1, node->right->data}});
+                    }
+                    if(node->left){
+                        st.push_back({node->left, {p.x - 1, p.y + 1, node->left->data}});
+                    }
+                }
+            }
+        });
+        buffers.push_back(move(top));
+
+        // Find the column range and the
+        // offset of every buffer
+        int minCol = INT_MAX, maxCol = INT_MIN;
+        vector<size_t> start(buffers.size() + 1, 0);
+        for(size_t b = 0; b < buffers.size(); b++){
+            for(const Triple& p : buffers[b]){
+                minCol = min(minCol, p.x);
+                maxCol = max(maxCol, p.x);
+            }
+            start[b + 1] = start[b] + buffers[b].size();
+        }
+
+        // Concatenate the buffers into one
+        // array of unsigned sort keys
+        size_t n = start.back();
+        vector<Keys> keys(n), tmp(n);
+        runParallel(buffers.size(), [&](int b){
+            size_t pos = start[b];
+            for(const Triple& p : buffers[b]){
+                keys[pos].key[0] = (uint32_t)p.value ^ 0x80000000u;
+                keys[pos].key[1] = (uint32_t)p.y;
+                keys[pos].key[2] = (uint32_t)(p.x - minCol);
+                pos++;
+            }
+            vector<Triple>().swap(buffers[b]);
+        });
+
+        // Stable LSD radix sort on (column, level, value),
+        // the least significant key is sorted first
+        for(int k = 0; k < 3; k++){
+            for(int shift = 0; shift < 32; shift += 8){
+                if(radixPass(keys, tmp, k, shift, numThreads)){
+                    keys.swap(tmp);
+                }
+            }
+        }
+
+        // Walk the sorted keys and append every
+        // value to the vector of its column
+        ans.resize(maxCol - minCol + 1);
+        for(const Keys& k : keys){
+            ans[k.key[2]].push_back((int)(k.key[0] ^ 0x80000000u));
+        }
+        return ans;
+    }
+
+private:
+    // Function to perform the two-pass flat bucket
+    // traversal on the current thread
+    vector<vector<int>> findVerticalSequential(Node* root){
+        // First pass: BFS using a flat array
+        // as the queue, the array keeps every
+        // node in level order once we are done
+        vector<Entry> order;
+        order.push_back({root, 0, 0});
+        int minCol = 0, maxCol = 0;
+        for(size_t head = 0; head < order.size(); head++){
+            // Copy the entry as push_back
+            // may reallocate the array
+            Entry e = order[head];
+            minCol = min(minCol, e.x);
+            maxCol = max(maxCol, e.x);
+            if(e.node->left){
+                order.push_back({e.node->left, e.x - 1, e.y + 1});
+            }
+            if(e.node->right){
+                order.push_back({e.node->right, e.x + 1, e.y + 1});
+            }
+        }
+
+        // Count the nodes in every column and
+        // turn the counts into starting offsets
+        int width = maxCol - minCol + 1;
+        vector<int> start(width + 1, 0);
+        for(const Entry& e : order){
+            start[e.x - minCol + 1]++;
+        }
+        for(int c = 0; c < width; c++){
+            start[c + 1] += start[c];
+        }
+
+        // Second pass: scatter values and levels
+        // into the preallocated flat buckets
+        int n = order.size();
+        vector<int> values(n), levels(n);
+        vector<int> fill(start.begin(), start.end() - 1);
+        for(const Entry& e : order){
+            int pos = fill[e.x - minCol]++;
+            values[pos] = e.node->data;
+            levels[pos] = e.y;
+        }
+
+        // Sort only the runs of nodes that
+        // share both the column and the level
+        vector<vector<int>> ans(width);
+        for(int c = 0; c < width; c++){
+            int i = start[c];
+            int end = start[c + 1];
+            while(i < end){
+                int j = i + 1;
+                while(j < end && levels[j] == levels[i]){
+                    j++;
+                }
+                if(j - i > 1){
+                    sort(values.begin() + i, values.begin() + j);
+                }
+                i = j;
+            }
+            ans[c].assign(values.begin() + start[c], values.begin() + end);
+        }
+        return ans;
+    }
+
+    // Function to run fn(0) ... fn(count - 1)
+    // each on its own thread and wait for them
+    template <typename Fn>
+    void runParallel(int count, Fn fn){
+        vector<thread> workers;
+        for(int t = 0; t < count; t++){
+            workers.emplace_back(fn, t);
+        }
+        for(auto& w : workers){
+            w.join();
+        }
+    }
+
+    // Function to perform one stable counting pass on
+    // the byte of key[k] at 'shift' using all threads,
+    // returns false if the pass was skipped
+    bool radixPass(const vector<Keys>& src, vector<Keys>& dst,
+            int k, int shift, int numThreads){
+        size_t n = src.size();
+        vector<vector<size_t>> hist(numThreads, vector<size_t>(256, 0));
+
+        // Every thread counts the digits of its own chunk
+        runParallel(numThreads, [&](int t){
+            size_t lo = n * t / numThreads, hi = n * (t + 1) / numThreads;
+            for(size_t i = lo; i < hi; i++){
+                hist[t][(src[i].key[k] >> shift) & 255]++;
+            }
+        });
+
+        // Turn the counts into the output offset of every
+        // (digit, thread) pair, if one digit holds every
+        // key this pass would not change the order
+        size_t running = 0;
+        for(int d = 0; d < 256; d++){
+            size_t total = 0;
+            for(int t = 0; t < numThreads; t++){
+                total += hist[t][d];
+            }
+            if(total == n){
+                return false;
+            }
+            for(int t = 0; t < numThreads; t++){
+                size_t count = hist[t][d];
+                hist[t][d] = running;
+                running += count;
+            }
+        }
+
+        // Every thread scatters its chunk in order
+        // which keeps the pass stable
+        runParallel(numThreads, [&](int t){
+            size_t lo = n * t / numThreads, hi = n * (t + 1) / numThreads;
+            for(size_t i = lo; i < hi; i++){
+                dst[hist[t][(src[i].key[k] >> shift) & 255]++] = src[i];
+            }
+        });
+        return true;
+    }
+};
+
+// Helper function to
+// print the result
+void printResult(const vector<vector<int>>& result) {
+    for(const auto& level: result){
+        for(auto node: level){
+            cout << node << " ";
+        }
+        cout << endl;
+    }
+    cout << endl;
+}
+
+int main() {
+    // Creating a sample binary tree
+    Node* root = new Node(1);
+    root->left = new Node(2);
+    root->left->left = new Node(4);
+    root->left->right = new Node(10);
+    root->left->left->right = new Node(5);
+    root->left->left->right->right = new Node(6);
+    root->right = new Node(3);
+    root->right->right = new Node(10);
+    root->right->left = new Node(9);
+
+    Solution solution;
+
+    // Get the Vertical traversal
+    vector<vector<int>> verticalTraversal =
+                    solution.findVertical(root);
+
+    // Print the result
+    cout << "Vertical Traversal: ";
+    printResult(verticalTraversal);
+
+    return 0;
+}
+
+/*
+Time Complexity: O(N / P + P * 256 * passes) where N is the number of nodes in the Binary Tree and P is the number of threads.
+The traversal and every radix pass touch each node once spread over P threads, and at most 12 passes are needed (4 bytes of each key), fewer when the bytes of a key do not vary.
+The top of the tree expanded on the main thread holds only O(P) subtrees per level for O(log P) levels and is negligible.
+A tree that does not branch out within these levels falls back to the sequential two-pass solution in O(N + W + N log K) as above.
+
+Space Complexity: O(N + P * 256) where N is the number of nodes in the Binary Tree and P is the number of threads.
+The thread-local buffers and the two key arrays hold N entries each, and every thread keeps a histogram of 256 counters per pass.
+Each DFS stack is bounded by the height of its subtree.
+*/
@@ -98,4 +98,543 @@ This complexity arises from visiting each node of the two binary nodes during th
 Space Complexity: O(1) as no additional space or data structures is created that is proportional to the input size of the tree. 
 O(H) Recursive Stack Auxiliary Space : The recursion stack space is determined by the maximum depth of the recursion, which is the height of the binary tree denoted as H. 
 In the balanced case it is log2N and in the worst case (its N).
-*/
\ No newline at end of file
+*/
+
+//Merkle Hash Approach :
+/*
+Algorithm / Intuition
+The recursive comparison visits every node of both trees on every call. When the same pair of trees is compared again and again, we can do much better by remembering a fingerprint of every subtree.
+Every node stores a 64 bit Merkle hash computed from its value and the hashes of its two children: hash(node) = H(data, hash(left), hash(right)), where an empty subtree has a fixed hash.
+H mixes its inputs in order, so the hash depends on the values and on the exact shape of the subtree.
+Identical subtrees always have equal hashes. So if the root hashes differ, the trees are certainly different, which we learn in O(1).
+Different trees can only have equal hashes by a collision, which is very unlikely for a 64 bit hash. When the root hashes are equal we still run the structural comparison to rule a collision out,
+unless the caller chooses to trust the hash.
+
+Keeping the hashes up to date: the hash of a node only depends on its subtree, so changing a value or relinking a child only changes the hashes of the node and its ancestors.
+With a parent pointer in every node we recompute them walking up to the root, which is O(H) per change.
+
+Diff: to find where two replicas differ we descend from the roots and only enter pairs of subtrees whose hashes differ, since equal hashes mean equal subtrees.
+Every reported difference costs one root to node path, so reconciling two replicas costs O(changes * H) instead of O(N).
+
+Algorithm:
+Step 1: Store data, hash, left, right and parent in every node. Use setValue, setLeft and setRight to change the tree; each of them updates the hashes from the changed node up to the root.
+Step 2: isIdentical(node1, node2): if the hashes differ return false. Otherwise return true if the caller trusts the hash, else run the recursive comparison.
+Step 3: diff(node1, node2): if the hashes are equal return. If one of them is NULL, or their values differ, report the pair. Then recurse into the left pair and the right pair.
+*/
+
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <utility>
+
+using namespace std;
+
+// Node structure for the binary tree with the
+// Merkle hash of its subtree and its parent
+struct Node {
+    int data;
+    uint64_t hash;
+    Node* left;
+    Node* right;
+    Node* parent;
+    // Constructor to initialize
+    // the node with a value
+    Node(int val) : data(val), hash(0), left(nullptr), right(nullptr), parent(nullptr) {}
+};
+
+class MerkleTree {
+public:
+    // Function to create a new leaf
+    // node with its hash computed
+    static Node* makeNode(int val) {
+        Node* node = new Node(val);
+        node->hash = combine(node);
+        return node;
+    }
+
+    // Function to change the value of a node
+    static void setValue(Node* node, int val) {
+        node->data = val;
+        rehashPath(node);
+    }
+
+    // Function to replace the left subtree of
+    // 'parent' with 'child', which may be NULL
+    static void setLeft(Node* parent, Node* child) {
+        if (parent->left) {
+            parent->left->parent = nullptr;
+        }
+        parent->left = child;
+        if (child) {
+            child->parent = parent;
+        }
+        rehashPath(parent);
+    }
+
+    // Function to replace the right subtree of
+    // 'parent' with 'child', which may be NULL
+    static void setRight(Node* parent, Node* child) {
+        if (parent->right) {
+            parent->right->parent = nullptr;
+        }
+        parent->right = child;
+        if (child) {
+            child->parent = parent;
+        }
+        rehashPath(parent);
+    }
+
+    // Function to check if two binary trees are identical,
+    // comparing the root hashes first and falling back to
+    // the structural check unless the hash is trusted
+    static bool isIdentical(Node* node1, Node* node2, bool trustHash = false) {
+        if (hashOf(node1) != hashOf(node2)) {
+            return false;
+        }
+        return trustHash || isIdenticalUtil(node1, node2);
+    }
+
+    // Function to collect the pairs of nodes that differ
+    // between two trees, descending only into subtrees
+    // whose hashes do not match
+    static void diff(Node* node1, Node* node2, vector<pair<Node*, Node*>>& out) {
+        if (hashOf(node1) == hashOf(node2)) {
+            return;
+        }
+        if (node1 == NULL || node2 == NULL) {
+            // A whole subtree is missing on one side
+            out.push_back({node1, node2});
+            return;
+        }
+        if (node1->data != node2->data) {
+            out.push_back({node1, node2});
+        }
+        diff(node1->left, node2->left, out);
+        diff(node1->right, node2->right, out);
+    }
+
+private:
+    // Hash of an empty subtree
+    static const uint64_t emptyHash = 0x6a09e667f3bcc908ull;
+
+    static uint64_t hashOf(Node* node) {
+        if (node == NULL) {
+            return emptyHash;
+        }
+        return node->hash;
+    }
+
+    // 64 bit finaliser spreading every
+    // input bit over the whole output
+    static uint64_t mix(uint64_t x) {
+        x ^= x >> 30;
+        x *= 0xbf58476d1ce4e5b9ull;
+        x ^= x >> 27;
+        x *= 0x94d049bb133111ebull;
+        x ^= x >> 31;
+        return x;
+    }
+
+    // Function to compute the hash of a node from its
+    // value and the hashes of its children, in order
+    static uint64_t combine(Node* node) {
+        uint64_t h = mix((uint64_t)(uint32_t)node->data + 0x9e3779b97f4a7c15ull);
+        h = mix(h ^ hashOf(node->left));
+        h = mix(h + hashOf(node->right) * 0x9e3779b97f4a7c15ull);
+        return h;
+    }
+
+    // Function to recompute the hashes from
+    // 'node' up to the root of its tree
+    static void rehashPath(Node* node) {
+        while (node) {
+            node->hash = combine(node);
+            node = node->parent;
+        }
+    }
+
+    // Recursive structural comparison from above
+    static bool isIdenticalUtil(Node* node1, Node* node2) {
+        if (node1 == NULL && node2 == NULL) {
+            return true;
+        }
+        if (node1 == NULL || node2 == NULL) {
+            return false;
+        }
+        return ((node1->data == node2->data)
+            && isIdenticalUtil(node1->left, node2->left)
+                && isIdenticalUtil(node1->right, node2->right));
+    }
+};
+
+
+int main() {
+    // Node1
+    Node* root1 = MerkleTree::makeNode(1);
+    MerkleTree::setLeft(root1, MerkleTree::makeNode(2));
+    MerkleTree::setRight(root1, MerkleTree::makeNode(3));
+    MerkleTree::setLeft(root1->left, MerkleTree::makeNode(4));
+
+    // Node2
+    Node* root2 = MerkleTree::makeNode(1);
+    MerkleTree::setLeft(root2, MerkleTree::makeNode(2));
+    MerkleTree::setRight(root2, MerkleTree::makeNode(3));
+    MerkleTree::setLeft(root2->left, MerkleTree::makeNode(4));
+
+    if (MerkleTree::isIdentical(root1, root2)) {
+        cout << "The binary trees are identical." << endl;
+    } else {
+        cout << "The binary trees are not identical." << endl;
+    }
+
+    // Change one replica and find the
+    // differences through the hashes
+    MerkleTree::setValue(root2->left->left, 5);
+    MerkleTree::setRight(root2->right, MerkleTree::makeNode(6));
+
+    if (MerkleTree::isIdentical(root1, root2)) {
+        cout << "After the update the binary trees are identical." << endl;
+    } else {
+        cout << "After the update the binary trees are not identical." << endl;
+    }
+
+    vector<pair<Node*, Node*>> changes;
+    MerkleTree::diff(root1, root2, changes);
+    for (auto& c : changes) {
+        cout << "Difference: "
+             << (c.first ? to_string(c.first->data) : "missing") << " vs "
+             << (c.second ? to_string(c.second->data) : "missing") << endl;
+    }
+
+    return 0;
+}
+
+/*
+Time Complexity: O(1) for isIdentical when the trees differ, as only the root hashes are compared.
+When the hashes match, the structural check takes O(N + M), or O(1) if the 64 bit hash is trusted.
+Every update takes O(H) where H is the height of the tree, as only the hashes of the ancestors are recomputed.
+diff takes O(D * H) where D is the number of differences, as it only follows paths with mismatching hashes.
+
+Space Complexity: O(N) for the hash and the parent pointer stored in every node.
+diff and the structural check use recursion stack space proportional to the height of the tree.
+*/
+
+//Parallel Early Exit Approach :
+/*
+Algorithm / Intuition
+The recursive comparison runs on one thread, and when the trees differ it only stops at the first mismatch in its own order of visiting the nodes.
+The comparisons of the left pair of subtrees and the right pair of subtrees are independent, so they can run as separate tasks on different cores.
+All tasks share one atomic mismatch flag. The task that finds the first mismatch sets it, and every task checks it before each pair of nodes,
+so all workers stop soon after the first difference anywhere in the trees instead of finishing their own subtrees.
+The same code checks whether two trees are mirror images by pairing the left child of one node with the right child of the other,
+which is the isSymmetricUtil check of Check if the Binary tree is Symmetric, so isSymmetric(root) compares root->left with root->right.
+As in the parallel construction, tasks are only spawned up to a depth at which there are a few tasks per core. Below that each task compares its subtrees with an explicit stack,
+which also keeps deep subtrees from overflowing the call stack.
+
+Flat layout: a tree can also be stored as two arrays, its preorder values and a shape bitmap with two bits per node telling whether the node has a left and a right child.
+The shape bitmap and the preorder values together describe the tree exactly, so two trees are identical exactly when both arrays are equal.
+Comparing contiguous arrays needs no pointer chasing at all: we first compare the bitmaps, and only if the shapes match we compare the value arrays.
+Both are compared with memcmp, which the standard library implements with vector (SIMD) instructions, split into equal ranges across the threads and into blocks checking the shared flag.
+
+Algorithm:
+Step 1: Clear the mismatch flag and compare the two roots.
+Step 2: compare(node1, node2): if the flag is set return. If exactly one node is NULL or their values differ, set the flag and return.
+Step 3: Above the task depth limit compare the left pair in a new task and the right pair on the current thread, then wait for the task. Below it compare both pairs with an explicit stack, checking the flag for every pair.
+Step 4 (flat layout): if the tree sizes or the shape bitmaps differ return false. Otherwise compare the value arrays block by block on all threads, stopping once the flag is set.
+*/
+
+
+#include <iostream>
+#include <vector>
+#include <atomic>
+#include <future>
+#include <thread>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <chrono>
+
+using namespace std;
+
+// Node structure for the binary tree
+struct Node {
+    int data;
+    Node* left;
+    Node* right;
+    // Constructor to initialize
+    // the node with a value
+    Node(int val) : data(val), left(nullptr), right(nullptr) {}
+};
+
+// Tree stored as its preorder values and a shape
+// bitmap, bit 2i tells if node i has a left child
+// and bit 2i + 1 if it has a right child
+struct FlatTree {
+    vector<int> values;
+    vector<uint64_t> shape;
+};
+
+class ParallelComparator {
+public:
+    ParallelComparator() {
+        // Allow a few tasks per core
+        numThreads = max(1u, thread::hardware_concurrency());
+        maxDepth = 2;
+        while ((1 << maxDepth) < 4 * numThreads) {
+            maxDepth++;
+        }
+    }
+
+    // Function to check if two binary
+    // trees are identical in parallel
+    bool isIdentical(Node* node1, Node* node2) {
+        mismatch = false;
+        compare(node1, node2, false, 0);
+        return !mismatch;
+    }
+
+    // Function to check if a binary tree
+    // is symmetric in parallel
+    bool isSymmetric(Node* root) {
+        if (!root) {
+            return true;
+        }
+        mismatch = false;
+        compare(root->left, root->right, true, 0);
+        return !mismatch;
+    }
+
+    // Function to store a tree as its preorder
+    // values and its shape bitmap
+    static FlatTree flatten(Node* root) {
+        FlatTree flat;
+        vector<Node*> st;
+        if (root) {
+            st.push_back(root);
+        }
+        while (!st.empty()) {
+            Node* node = st.back();
+            st.pop_back();
+            size_t i = flat.values.size();
+            flat.values.push_back(node->data);
+            if (flat.shape.size() * 32 <= i) {
+                flat.shape.push_back(0);
+            }
+            uint64_t bits = (node->left ? 1 : 0) | (node->right ? 2 : 0);
+            flat.shape[i / 32] |= bits << (2 * (i % 32));
+            if (node->right) {
+                st.push_back(node->right);
+            }
+            if (node->left) {
+                st.push_back(node->left);
+            }
+        }
+        return flat;
+    }
+
+    // Function to check if two flat trees are
+    // identical, comparing the shapes first and
+    // then the value arrays on all threads
+    bool isIdentical(const FlatTree& tree1, const FlatTree& tree2) {
+        mismatch = false;
+        if (tree1.values.size() != tree2.values.size()
+                || !equalRange(tree1.shape.data(), tree2.shape.data(), tree1.shape.size())) {
+            return false;
+        }
+
+        size_t n = tree1.values.size();
+        vector<thread> workers;
+        for (int t = 0; t < numThreads; t++) {
+            size_t from = n * t / numThreads;
+            size_t to = n * (t + 1) / numThreads;
+            workers.emplace_back([&, from, to] {
+                if (!equalRange(tree1.values.data() + from, tree2.values.data() + from, to - from)) {
+                    mismatch = true;
+                }
+            });
+        }
+        for (auto& w : workers) {
+            w.join();
+        }
+        return !mismatch;
+    }
+
+private:
+    // Set by the first task finding a difference
+    atomic<bool> mismatch{false};
+    int numThreads = 1;
+    int maxDepth = 0;
+
+    // Elements compared between two
+    // checks of the mismatch flag
+    static const size_t blockSize = 1 << 14;
+
+    // Function to compare the pair (node1, node2) and
+    // their subtrees, pairing the left child of node1
+    // with the right child of node2 when 'mirror'
+    void compare(Node* node1, Node* node2, bool mirror, int depth) {
+        if (mismatch.load(memory_order_relaxed)) {
+            return;
+        }
+        if (node1 == NULL || node2 == NULL || node1->data != node2->data) {
+            if (node1 != node2) {
+                mismatch = true;
+            }
+            return;
+        }
+
+        Node* first2 = mirror ? node2->right : node2->left;
+        Node* second2 = mirror ? node2->left : node2->right;
+
+        if (depth < maxDepth) {
+            // Compare the first pair in a new task
+            // while this thread compares the second
+            future<void> first = async(launch::async, [=] {
+                compare(node1->left, first2, mirror, depth + 1);
+            });
+            compare(node1->right, second2, mirror, depth + 1);
+            first.get();
+        }
+        else {
+            compareSequential(node1->left, first2, mirror);
+            compareSequential(node1->right, second2, mirror);
+        }
+    }
+
+    // Function to compare two subtrees with an explicit
+    // stack, stopping once any task found a mismatch
+    void compareSequential(Node* node1, Node* node2, bool mirror) {
+        vector<pair<Node*, Node*>> st;
+        st.push_back({node1, node2});
+        while (!st.empty()) {
+            if (mismatch.load(memory_order_relaxed)) {
+                return;
+            }
+            Node* a = st.back().first;
+            Node* b = st.back().second;
+            st.pop_back();
+
+            if (a == NULL || b == NULL) {
+                if (a != b) {
+                    mismatch = true;
+                    return;
+                }
+                continue;
+            }
+            if (a->data != b->data) {
+                mismatch = true;
+                return;
+            }
+            st.push_back({a->right, mirror ? b->left : b->right});
+            st.push_back({a->left, mirror ? b->right : b->left});
+        }
+    }
+
+    // Function to compare two arrays with memcmp
+    // block by block, checking the mismatch flag
+    template <typename T>
+    bool equalRange(const T* a, const T* b, size_t n) {
+        for (size_t i = 0; i < n; i += blockSize) {
+            if (mismatch.load(memory_order_relaxed)) {
+                return false;
+            }
+            size_t len = min(size_t(blockSize), n - i);
+            if (memcmp(a + i, b + i, len * sizeof(T)) != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+// Function to build a tree with 'n' nodes whose
+// shape and values only depend on 'n' and 'seed'
+Node* buildTree(int n, unsigned seed) {
+    if (n == 0) {
+        return NULL;
+    }
+    seed = seed * 1103515245u + 12345u;
+    Node* node = new Node(seed >> 16);
+    int leftSize = (n - 1) / 2 + (int)(seed % 3) - 1;
+    leftSize = max(0, min(n - 1, leftSize));
+    node->left = buildTree(leftSize, seed ^ 0x5bd1e995u);
+    node->right = buildTree(n - 1 - leftSize, seed + 0x27d4eb2du);
+    return node;
+}
+
+// Function to return the rightmost node
+Node* rightmost(Node* root) {
+    while (root->right) {
+        root = root->right;
+    }
+    return root;
+}
+
+
+int main() {
+    ParallelComparator comparator;
+
+    // Node1
+    Node* root1 = new Node(1);
+    root1->left = new Node(2);
+    root1->right = new Node(3);
+    root1->left->left = new Node(4);
+
+    // Node2
+    Node* root2 = new Node(1);
+    root2->left = new Node(2);
+    root2->right = new Node(3);
+    root2->left->left = new Node(4);
+
+    if (comparator.isIdentical(root1, root2)) {
+        cout << "The binary trees are identical." << endl;
+    } else {
+        cout << "The binary trees are not identical." << endl;
+    }
+
+    // A symmetric tree
+    Node* sym = new Node(1);
+    sym->left = new Node(2);
+    sym->right = new Node(2);
+    sym->left->left = new Node(3);
+    sym->right->right = new Node(3);
+    cout << "Symmetric: " << comparator.isSymmetric(sym) << endl;
+
+    // Compare two large identical trees, then
+    // change one node far to the right
+    int n = 1 << 21;
+    Node* big1 = buildTree(n, 42);
+    Node* big2 = buildTree(n, 42);
+    FlatTree flat1 = ParallelComparator::flatten(big1);
+    FlatTree flat2 = ParallelComparator::flatten(big2);
+
+    for (int round = 0; round < 2; round++) {
+        auto t0 = chrono::steady_clock::now();
+        bool pointerResult = comparator.isIdentical(big1, big2);
+        auto t1 = chrono::steady_clock::now();
+        bool flatResult = comparator.isIdentical(flat1, flat2);
+        auto t2 = chrono::steady_clock::now();
+
+        cout << (round == 0 ? "Identical trees" : "One changed node") << ", n = " << n
+             << ": pointers " << pointerResult << " in "
+             << chrono::duration<double, milli>(t1 - t0).count() << " ms, flat "
+             << flatResult << " in "
+             << chrono::duration<double, milli>(t2 - t1).count() << " ms" << endl;
+
+        rightmost(big2)->data++;
+        flat2.values.back()++;
+    }
+
+    return 0;
+}
+
+/*
+Time Complexity: O(N / P + H) for identical trees where N is the number of nodes, P is the number of cores and H is the height of the tree,
+as the total work is O(N) like in the recursive solution and the tasks divide it over the cores when the tree is reasonably balanced.
+When the trees differ, every worker stops within one pair of nodes (one block for the flat layout) after the first mismatch is found.
+The flat comparison is O(N / P) and reads both trees sequentially.
+
+Space Complexity: O(N) for the explicit stacks in the worst case, O(H) for a balanced tree. The flat layout takes N values and 2N bits of shape per tree.
+*/